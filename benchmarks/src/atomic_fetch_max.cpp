@@ -0,0 +1,59 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+// Many threads folding samples into one shared gauge, as a metrics aggregator does with max latency and total time.
+
+namespace {
+    template <class T>
+    std::atomic<T> gauge{};
+
+    template <class T>
+    T sample(std::uint32_t& state) { // cheap per-thread stream of values in [0, 1000)
+        state = state * 1664525u + 1013904223u;
+        return static_cast<T>((state >> 8) % 1000);
+    }
+
+    template <class T>
+    void BM_fetch_max(benchmark::State& state) {
+        auto seed = static_cast<std::uint32_t>(state.thread_index()) + 1;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(gauge<T>.fetch_max(sample<T>(seed), std::memory_order_relaxed));
+        }
+    }
+
+    template <class T>
+    void BM_cas_loop_max(benchmark::State& state) {
+        // the hand-written loop fetch_max replaces; it writes even when the stored value already dominates
+        auto seed = static_cast<std::uint32_t>(state.thread_index()) + 1;
+        for (auto _ : state) {
+            const T value = sample<T>(seed);
+            T current     = gauge<T>.load(std::memory_order_relaxed);
+            while (!gauge<T>.compare_exchange_weak(current, (std::max)(current, value), std::memory_order_relaxed)) {
+            }
+
+            benchmark::DoNotOptimize(current);
+        }
+    }
+
+    template <class T>
+    void BM_fetch_add(benchmark::State& state) {
+        auto seed = static_cast<std::uint32_t>(state.thread_index()) + 1;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(gauge<T>.fetch_add(sample<T>(seed), std::memory_order_relaxed));
+        }
+    }
+} // namespace
+
+BENCHMARK(BM_fetch_max<std::uint64_t>)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(BM_fetch_max<double>)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(BM_cas_loop_max<std::uint64_t>)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(BM_cas_loop_max<double>)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(BM_fetch_add<std::uint64_t>)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(BM_fetch_add<double>)->ThreadRange(1, 32)->UseRealTime();
+
+BENCHMARK_MAIN();
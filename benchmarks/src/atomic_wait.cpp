@@ -0,0 +1,150 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <atomic>
+#include <barrier>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <deque>
+#include <latch>
+#include <semaphore>
+#include <thread>
+#include <type_traits>
+
+// Each benchmark measures a round trip: the benchmark thread wakes a partner thread, which wakes it back.
+
+namespace {
+    struct wide { // not lock-free, so waits go through the indirect path
+        unsigned long long value;
+        unsigned long long padding[2];
+    };
+
+    template <class T>
+    T make(const unsigned long long value) {
+        if constexpr (std::is_same_v<T, wide>) {
+            return wide{value, {}};
+        } else {
+            return static_cast<T>(value);
+        }
+    }
+
+    template <class T>
+    void BM_atomic_wait(benchmark::State& state) {
+        // the benchmark thread stores odd values, the partner stores even ones
+        std::atomic<T> turn{make<T>(0)};
+        std::atomic<bool> done{false};
+
+        std::thread partner([&] {
+            for (unsigned long long i = 0;; i += 2) {
+                turn.wait(make<T>(i));
+                if (done.load(std::memory_order_relaxed)) {
+                    return;
+                }
+
+                turn.store(make<T>(i + 2));
+                turn.notify_one();
+            }
+        });
+
+        unsigned long long i = 0;
+        for (auto _ : state) {
+            turn.store(make<T>(i + 1));
+            turn.notify_one();
+            turn.wait(make<T>(i + 1));
+            i += 2;
+        }
+
+        done.store(true, std::memory_order_relaxed);
+        turn.store(make<T>(i + 1));
+        turn.notify_one();
+        partner.join();
+    }
+
+    template <class Semaphore>
+    void BM_semaphore(benchmark::State& state) {
+        Semaphore ping{0};
+        Semaphore pong{0};
+        std::atomic<bool> done{false};
+
+        std::thread partner([&] {
+            for (;;) {
+                ping.acquire();
+                if (done.load(std::memory_order_relaxed)) {
+                    return;
+                }
+
+                pong.release();
+            }
+        });
+
+        for (auto _ : state) {
+            ping.release();
+            pong.acquire();
+        }
+
+        done.store(true, std::memory_order_relaxed);
+        ping.release();
+        partner.join();
+    }
+
+    void BM_latch(benchmark::State& state) {
+        // a latch can't be reused, so build a pair for every round trip up front
+        const auto rounds = static_cast<std::size_t>(state.max_iterations);
+        std::deque<std::latch> pings;
+        std::deque<std::latch> pongs;
+        for (std::size_t i = 0; i != rounds; ++i) {
+            pings.emplace_back(1);
+            pongs.emplace_back(1);
+        }
+
+        std::thread partner([&] {
+            for (std::size_t i = 0; i != rounds; ++i) {
+                pings[i].wait();
+                pongs[i].count_down();
+            }
+        });
+
+        std::size_t i = 0;
+        for (auto _ : state) {
+            pings[i].count_down();
+            pongs[i].wait();
+            ++i;
+        }
+
+        partner.join();
+    }
+
+    void BM_barrier(benchmark::State& state) {
+        // one phase of a two-thread barrier; both threads arrive, so every phase is a round trip
+        std::barrier b(2);
+        std::atomic<bool> done{false};
+
+        std::thread partner([&] {
+            for (;;) {
+                b.arrive_and_wait();
+                if (done.load(std::memory_order_relaxed)) {
+                    return;
+                }
+            }
+        });
+
+        for (auto _ : state) {
+            b.arrive_and_wait();
+        }
+
+        done.store(true, std::memory_order_relaxed);
+        b.arrive_and_wait();
+        partner.join();
+    }
+} // namespace
+
+BENCHMARK(BM_atomic_wait<unsigned char>)->UseRealTime();
+BENCHMARK(BM_atomic_wait<unsigned int>)->UseRealTime();
+BENCHMARK(BM_atomic_wait<unsigned long long>)->UseRealTime();
+BENCHMARK(BM_atomic_wait<wide>)->UseRealTime();
+BENCHMARK(BM_semaphore<std::binary_semaphore>)->UseRealTime();
+BENCHMARK(BM_semaphore<std::counting_semaphore<>>)->UseRealTime();
+BENCHMARK(BM_latch)->UseRealTime();
+BENCHMARK(BM_barrier)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,77 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <atomic>
+#include <barrier>
+#include <benchmark/benchmark.h>
+#include <thread>
+#include <vector>
+
+namespace {
+    template <class Barrier>
+    void BM_arrive_and_wait(benchmark::State& state) {
+        // latency of one barrier phase, with the benchmark thread as one of the participants
+        const auto thread_count = static_cast<int>(state.range(0));
+        Barrier b(thread_count);
+        std::atomic<bool> done{false};
+
+        std::vector<std::thread> workers;
+        for (int i = 1; i < thread_count; ++i) {
+            workers.emplace_back([&] {
+                for (;;) {
+                    b.arrive_and_wait();
+                    if (done.load(std::memory_order_relaxed)) {
+                        return;
+                    }
+                }
+            });
+        }
+
+        for (auto _ : state) {
+            b.arrive_and_wait();
+        }
+
+        done.store(true, std::memory_order_relaxed);
+        b.arrive_and_wait();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    template <class Barrier>
+    void BM_arrive_then_wait(benchmark::State& state) {
+        // same, but splitting arrival from waiting, as a stencil step that overlaps independent work would
+        const auto thread_count = static_cast<int>(state.range(0));
+        Barrier b(thread_count);
+        std::atomic<bool> done{false};
+
+        std::vector<std::thread> workers;
+        for (int i = 1; i < thread_count; ++i) {
+            workers.emplace_back([&] {
+                for (;;) {
+                    b.wait(b.arrive());
+                    if (done.load(std::memory_order_relaxed)) {
+                        return;
+                    }
+                }
+            });
+        }
+
+        for (auto _ : state) {
+            b.wait(b.arrive());
+        }
+
+        done.store(true, std::memory_order_relaxed);
+        b.wait(b.arrive());
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+} // namespace
+
+BENCHMARK(BM_arrive_and_wait<std::barrier<>>)->RangeMultiplier(2)->Range(2, 128)->UseRealTime();
+BENCHMARK(BM_arrive_and_wait<stdext::tree_barrier<>>)->RangeMultiplier(2)->Range(2, 128)->UseRealTime();
+BENCHMARK(BM_arrive_then_wait<std::barrier<>>)->RangeMultiplier(2)->Range(2, 128)->UseRealTime();
+BENCHMARK(BM_arrive_then_wait<stdext::tree_barrier<>>)->RangeMultiplier(2)->Range(2, 128)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,130 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <list>
+#include <map>
+#include <memory_resource>
+#include <set>
+#include <vector>
+
+namespace {
+    class counting_resource : public std::pmr::memory_resource {
+    public:
+        std::size_t bytes_in_use = 0;
+
+    private:
+        void* do_allocate(const std::size_t bytes, const std::size_t align) override {
+            bytes_in_use += bytes;
+            return std::pmr::new_delete_resource()->allocate(bytes, align);
+        }
+
+        void do_deallocate(void* const ptr, const std::size_t bytes, const std::size_t align) override {
+            bytes_in_use -= bytes;
+            std::pmr::new_delete_resource()->deallocate(ptr, bytes, align);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& that) const noexcept override {
+            return this == &that;
+        }
+    };
+
+    template <class Container>
+    void fill(Container& c, const int n) {
+        for (int i = 0; i < n; ++i) {
+            if constexpr (requires { c.push_back(i); }) {
+                c.push_back(i);
+            } else if constexpr (requires { typename Container::mapped_type; }) {
+                c.emplace_hint(c.end(), i, i);
+            } else {
+                c.emplace_hint(c.end(), i);
+            }
+        }
+    }
+
+    template <class Pool, class Container>
+    void BM_footprint(benchmark::State& state) {
+        // upstream bytes per element held by a pool serving a node-based container
+        const auto n = static_cast<int>(state.range(0));
+        std::size_t bytes_in_use = 0;
+        for (auto _ : state) {
+            counting_resource upstream;
+            Pool pool{&upstream};
+            Container c{&pool};
+            fill(c, n);
+            benchmark::DoNotOptimize(c);
+            bytes_in_use = upstream.bytes_in_use;
+        }
+
+        state.counters["bytes_per_elem"] = static_cast<double>(bytes_in_use) / n;
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    template <class Pool>
+    void BM_alloc_free(benchmark::State& state) {
+        // allocate a batch of blocks of one size and free them again
+        const auto size = static_cast<std::size_t>(state.range(0));
+        Pool pool;
+        std::vector<void*> ptrs(1024);
+        for (auto _ : state) {
+            for (auto& ptr : ptrs) {
+                ptr = pool.allocate(size, alignof(std::max_align_t));
+            }
+
+            benchmark::DoNotOptimize(ptrs.data());
+            for (const auto ptr : ptrs) {
+                pool.deallocate(ptr, size, alignof(std::max_align_t));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<long long>(ptrs.size()));
+    }
+
+    template <class Pool>
+    void BM_alloc_free_mixed(benchmark::State& state) {
+        // interleave sizes so that consecutive requests hit different pools, and free in a scattered order
+        Pool pool;
+        constexpr std::size_t sizes[] = {24, 40, 64, 100, 24, 48, 200, 32};
+        std::vector<void*> ptrs(1024);
+        for (auto _ : state) {
+            for (std::size_t i = 0; i < ptrs.size(); ++i) {
+                ptrs[i] = pool.allocate(sizes[i % std::size(sizes)]);
+            }
+
+            benchmark::DoNotOptimize(ptrs.data());
+            for (std::size_t i = 0; i < ptrs.size(); ++i) {
+                const std::size_t j = (i * 389) % ptrs.size();
+                pool.deallocate(ptrs[j], sizes[j % std::size(sizes)]);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<long long>(ptrs.size()));
+    }
+} // namespace
+
+using std_pool     = std::pmr::unsynchronized_pool_resource;
+using compact_pool = stdext::pmr::compact_pool_resource;
+
+void footprint_args(auto bm) {
+    bm->Arg(1000)->Arg(100000);
+}
+
+void size_args(auto bm) {
+    bm->Arg(16)->Arg(24)->Arg(48)->Arg(64)->Arg(100)->Arg(256);
+}
+
+BENCHMARK(BM_footprint<std_pool, std::pmr::list<int>>)->Apply(footprint_args);
+BENCHMARK(BM_footprint<compact_pool, std::pmr::list<int>>)->Apply(footprint_args);
+BENCHMARK(BM_footprint<std_pool, std::pmr::set<int>>)->Apply(footprint_args);
+BENCHMARK(BM_footprint<compact_pool, std::pmr::set<int>>)->Apply(footprint_args);
+BENCHMARK(BM_footprint<std_pool, std::pmr::map<int, int>>)->Apply(footprint_args);
+BENCHMARK(BM_footprint<compact_pool, std::pmr::map<int, int>>)->Apply(footprint_args);
+BENCHMARK(BM_footprint<std_pool, std::pmr::map<long long, long long>>)->Apply(footprint_args);
+BENCHMARK(BM_footprint<compact_pool, std::pmr::map<long long, long long>>)->Apply(footprint_args);
+BENCHMARK(BM_alloc_free<std_pool>)->Apply(size_args);
+BENCHMARK(BM_alloc_free<compact_pool>)->Apply(size_args);
+BENCHMARK(BM_alloc_free_mixed<std_pool>);
+BENCHMARK(BM_alloc_free_mixed<compact_pool>);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,111 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <deque>
+#include <string>
+
+using namespace std;
+
+// This is built twice: as benchmark-deque_blocks with the original deque layout, and as
+// benchmark-deque_large_blocks with _MSVC_STL_DEQUE_BLOCK_BYTES defined, to compare the two.
+
+struct payload {
+    size_t value;
+    size_t padding[2];
+};
+
+void make_element(int& out, const size_t i) {
+    out = static_cast<int>(i);
+}
+
+void make_element(payload& out, const size_t i) {
+    out = {i, {}};
+}
+
+void make_element(string& out, const size_t i) {
+    out.assign(i % 16, 'x');
+}
+
+template <class T>
+void push_back(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    T elem{};
+
+    for (auto _ : state) {
+        deque<T> d;
+        for (size_t i = 0; i != n; ++i) {
+            make_element(elem, i);
+            d.push_back(elem);
+        }
+
+        benchmark::DoNotOptimize(d);
+    }
+}
+
+template <class T>
+void push_front_pop_back(benchmark::State& state) {
+    // a queue that stays about the same size, as in a scheduler's work queue
+    const auto n = static_cast<size_t>(state.range(0));
+    deque<T> d(n);
+    T elem{};
+    size_t i = 0;
+
+    for (auto _ : state) {
+        make_element(elem, ++i);
+        d.push_front(elem);
+        d.pop_back();
+        benchmark::DoNotOptimize(d);
+    }
+}
+
+template <class T>
+void iterate(benchmark::State& state) {
+    deque<T> d(static_cast<size_t>(state.range(0)));
+    for (size_t i = 0; i != d.size(); ++i) {
+        make_element(d[i], i);
+    }
+
+    for (auto _ : state) {
+        size_t sum = 0;
+        for (const auto& elem : d) {
+            benchmark::DoNotOptimize(elem);
+            ++sum;
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+template <class T>
+void random_access(benchmark::State& state) {
+    deque<T> d(static_cast<size_t>(state.range(0)));
+    for (size_t i = 0; i != d.size(); ++i) {
+        make_element(d[i], i);
+    }
+
+    size_t index = 0;
+    for (auto _ : state) {
+        index = (index + 7919) % d.size();
+        benchmark::DoNotOptimize(d[index]);
+    }
+}
+
+BENCHMARK(push_back<int>)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(push_back<payload>)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(push_back<string>)->Arg(1 << 10)->Arg(1 << 20);
+
+BENCHMARK(push_front_pop_back<int>)->Arg(1 << 10);
+BENCHMARK(push_front_pop_back<payload>)->Arg(1 << 10);
+BENCHMARK(push_front_pop_back<string>)->Arg(1 << 10);
+
+BENCHMARK(iterate<int>)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(iterate<payload>)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(iterate<string>)->Arg(1 << 10)->Arg(1 << 20);
+
+BENCHMARK(random_access<int>)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(random_access<payload>)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(random_access<string>)->Arg(1 << 10)->Arg(1 << 20);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,43 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+std::vector<double> make_weights(const std::size_t n) {
+    // skewed weights, like popularity scores
+    std::mt19937 gen;
+    std::lognormal_distribution<double> dist(0.0, 2.0);
+    std::vector<double> weights(n);
+    for (auto& weight : weights) {
+        weight = dist(gen);
+    }
+
+    return weights;
+}
+
+void BM_construct(benchmark::State& state) {
+    const auto weights = make_weights(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::discrete_distribution<int> dist(weights.begin(), weights.end());
+        benchmark::DoNotOptimize(dist);
+    }
+}
+
+template <class Engine>
+void BM_sample(benchmark::State& state) {
+    const auto weights = make_weights(static_cast<std::size_t>(state.range(0)));
+    std::discrete_distribution<int> dist(weights.begin(), weights.end());
+    Engine gen;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dist(gen));
+    }
+}
+
+BENCHMARK(BM_construct)->RangeMultiplier(10)->Range(10, 1'000'000);
+BENCHMARK(BM_sample<std::mt19937>)->RangeMultiplier(10)->Range(10, 1'000'000);
+BENCHMARK(BM_sample<std::mt19937_64>)->RangeMultiplier(10)->Range(10, 1'000'000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,68 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <string>
+#include <vector>
+
+// Writes and then reads back a 64 MiB file sequentially, state.range(0) bytes per sputn/sgetn call, through
+// std::filebuf in binary mode and through stdext::native_filebuf.
+
+namespace {
+    constexpr std::size_t file_size = std::size_t{64} << 20;
+    const std::filesystem::path file_name{L"file_throughput.dat"};
+
+    template <class Filebuf>
+    void BM_write(benchmark::State& state) {
+        const auto chunk = static_cast<std::size_t>(state.range(0));
+        const std::vector<char> data(chunk, 'x');
+        for (auto _ : state) {
+            Filebuf buf;
+            buf.open(file_name, std::ios::out | std::ios::trunc | std::ios::binary);
+            for (std::size_t written = 0; written < file_size; written += chunk) {
+                buf.sputn(data.data(), static_cast<std::streamsize>(chunk));
+            }
+        }
+
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * file_size));
+    }
+
+    template <class Filebuf>
+    void BM_read(benchmark::State& state) {
+        const auto chunk = static_cast<std::size_t>(state.range(0));
+        {
+            std::filebuf buf;
+            buf.open(file_name, std::ios::out | std::ios::trunc | std::ios::binary);
+            const std::string data(file_size, 'x');
+            buf.sputn(data.data(), static_cast<std::streamsize>(data.size()));
+        }
+
+        std::vector<char> data(chunk);
+        for (auto _ : state) {
+            Filebuf buf;
+            buf.open(file_name, std::ios::in | std::ios::binary);
+            while (buf.sgetn(data.data(), static_cast<std::streamsize>(chunk)) != 0) {
+                benchmark::DoNotOptimize(data.data());
+            }
+        }
+
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * file_size));
+        std::filesystem::remove(file_name);
+    }
+} // namespace
+
+void common_args(auto bm) {
+    bm->ArgName("chunk")->Arg(256)->Arg(4 << 10)->Arg(64 << 10)->Arg(1 << 20)->UseRealTime();
+}
+
+BENCHMARK(BM_write<std::filebuf>)->Apply(common_args);
+BENCHMARK(BM_write<stdext::native_filebuf>)->Apply(common_args);
+BENCHMARK(BM_read<std::filebuf>)->Apply(common_args);
+BENCHMARK(BM_read<stdext::native_filebuf>)->Apply(common_args);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,92 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <forward_list>
+#include <hazard_pointer>
+#include <mutex>
+#include <shared_mutex>
+
+// Readers search a short linked list that a writer occasionally updates, as a routing or configuration table is.
+// The hazard pointer version publishes each update as a new copy of the list and retires the old one; the
+// shared_mutex version updates the list in place under an exclusive lock.
+
+namespace {
+    constexpr int list_size    = 64;
+    constexpr int write_period = 1024; // thread 0 writes once per this many lookups
+
+    std::forward_list<int> make_list() {
+        std::forward_list<int> list;
+        for (int i = list_size; i != 0; --i) {
+            list.push_front(i);
+        }
+
+        return list;
+    }
+
+    struct list_version : std::hazard_pointer_obj_base<list_version> {
+        std::forward_list<int> values = make_list();
+    };
+
+    std::atomic<list_version*> published{new list_version};
+
+    std::forward_list<int> locked_list = make_list();
+    std::shared_mutex list_mutex;
+
+    bool contains(const std::forward_list<int>& list, const int key) {
+        for (const int value : list) {
+            if (value == key) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void BM_hazard_pointer(benchmark::State& state) {
+        const bool writer = state.thread_index() == 0;
+        int key           = state.thread_index();
+        int until_write   = write_period;
+
+        std::hazard_pointer hp = std::make_hazard_pointer();
+        for (auto _ : state) {
+            key = (key + 7) % list_size;
+            benchmark::DoNotOptimize(contains(hp.protect(published)->values, key));
+            hp.reset_protection();
+
+            if (writer && --until_write == 0) {
+                until_write          = write_period;
+                const auto copy      = new list_version;
+                copy->values.front() = key;
+                published.exchange(copy)->retire();
+            }
+        }
+    }
+
+    void BM_shared_mutex(benchmark::State& state) {
+        const bool writer = state.thread_index() == 0;
+        int key           = state.thread_index();
+        int until_write   = write_period;
+
+        for (auto _ : state) {
+            key = (key + 7) % list_size;
+            {
+                std::shared_lock lock{list_mutex};
+                benchmark::DoNotOptimize(contains(locked_list, key));
+            }
+
+            if (writer && --until_write == 0) {
+                until_write = write_period;
+                std::scoped_lock lock{list_mutex};
+                locked_list.front() = key;
+            }
+        }
+    }
+} // namespace
+
+BENCHMARK(BM_hazard_pointer)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(BM_shared_mutex)->ThreadRange(1, 16)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,144 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <istream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+// Parses a 32 MiB file of decimal numbers, one per line, through std::ifstream and through stdext::mapped_filebuf:
+// line by line with getline, number by number with operator>>, and with from_chars over the whole file, which for
+// ifstream means reading it into a string first and for mapped_filebuf means parsing its view in place.
+
+namespace {
+    constexpr std::size_t file_size = std::size_t{32} << 20;
+    const std::filesystem::path file_name{L"mapped_file_parsing.dat"};
+
+    void write_file() {
+        std::string contents;
+        contents.reserve(file_size + 32);
+        for (unsigned int value = 0; contents.size() < file_size; value = value * 1'103'515'245u + 12'345u) {
+            contents += std::to_string(value % 1'000'000'000u);
+            contents += '\n';
+        }
+
+        std::ofstream out{file_name, std::ios::binary | std::ios::trunc};
+        out.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+    }
+
+    struct ifstream_source {
+        std::ifstream stream{file_name, std::ios::binary};
+
+        std::istream& get() {
+            return stream;
+        }
+    };
+
+    struct mapped_source {
+        stdext::mapped_filebuf buf;
+        std::istream stream{&buf};
+
+        mapped_source() {
+            buf.open(file_name);
+        }
+
+        std::istream& get() {
+            return stream;
+        }
+    };
+
+    template <class Source>
+    void BM_getline(benchmark::State& state) {
+        write_file();
+        for (auto _ : state) {
+            Source source;
+            std::string line;
+            std::size_t count = 0;
+            while (std::getline(source.get(), line)) {
+                ++count;
+            }
+
+            benchmark::DoNotOptimize(count);
+        }
+
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * file_size));
+        std::filesystem::remove(file_name);
+    }
+
+    template <class Source>
+    void BM_extract(benchmark::State& state) {
+        write_file();
+        for (auto _ : state) {
+            Source source;
+            unsigned long long sum = 0;
+            unsigned int value     = 0;
+            while (source.get() >> value) {
+                sum += value;
+            }
+
+            benchmark::DoNotOptimize(sum);
+        }
+
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * file_size));
+        std::filesystem::remove(file_name);
+    }
+
+    unsigned long long sum_numbers(std::string_view text) {
+        unsigned long long sum = 0;
+        const char* first      = text.data();
+        const char* const last = first + text.size();
+        while (first != last) {
+            unsigned int value = 0;
+            const auto result  = std::from_chars(first, last, value);
+            if (result.ec != std::errc{}) {
+                break;
+            }
+
+            sum += value;
+            first = result.ptr == last ? last : result.ptr + 1; // skip the newline
+        }
+
+        return sum;
+    }
+
+    void BM_from_chars_ifstream(benchmark::State& state) {
+        write_file();
+        for (auto _ : state) {
+            std::ifstream in{file_name, std::ios::binary};
+            const std::string text{std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+            benchmark::DoNotOptimize(sum_numbers(text));
+        }
+
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * file_size));
+        std::filesystem::remove(file_name);
+    }
+
+    void BM_from_chars_mapped(benchmark::State& state) {
+        write_file();
+        for (auto _ : state) {
+            stdext::mapped_filebuf buf;
+            buf.open(file_name);
+            benchmark::DoNotOptimize(sum_numbers(buf.view())); // smaller than a window, so this is the whole file
+        }
+
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * file_size));
+        std::filesystem::remove(file_name);
+    }
+} // namespace
+
+BENCHMARK(BM_getline<ifstream_source>)->UseRealTime();
+BENCHMARK(BM_getline<mapped_source>)->UseRealTime();
+BENCHMARK(BM_extract<ifstream_source>)->UseRealTime();
+BENCHMARK(BM_extract<mapped_source>)->UseRealTime();
+BENCHMARK(BM_from_chars_ifstream)->UseRealTime();
+BENCHMARK(BM_from_chars_mapped)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -5,6 +5,7 @@
 #include <benchmark/benchmark.h>
 #include <cstddef>
 #include <cstdint>
+#include <execution>
 #include <ranges>
 #include <vector>
 
@@ -17,6 +18,9 @@ constexpr int64_t no_pos = -1;
 enum class op {
     mismatch,
     lexi,
+    par_mismatch,
+    par_equal,
+    par_lexi,
 };
 
 template <class T, op Op>
@@ -33,6 +37,12 @@ void bm(benchmark::State& state) {
             benchmark::DoNotOptimize(ranges::mismatch(a, b));
         } else if constexpr (Op == op::lexi) {
             benchmark::DoNotOptimize(ranges::lexicographical_compare(a, b));
+        } else if constexpr (Op == op::par_mismatch) {
+            benchmark::DoNotOptimize(mismatch(execution::par, a.begin(), a.end(), b.begin(), b.end()));
+        } else if constexpr (Op == op::par_equal) {
+            benchmark::DoNotOptimize(equal(execution::par, a.begin(), a.end(), b.begin(), b.end()));
+        } else if constexpr (Op == op::par_lexi) {
+            benchmark::DoNotOptimize(lexicographical_compare(execution::par, a.begin(), a.end(), b.begin(), b.end()));
         }
     }
 }
@@ -52,4 +62,15 @@ BENCHMARK(bm<uint16_t, op::lexi>)->Apply(common_args);
 BENCHMARK(bm<uint32_t, op::lexi>)->Apply(common_args);
 BENCHMARK(bm<uint64_t, op::lexi>)->Apply(common_args);
 
+void parallel_args(auto bm) {
+    bm->Args({1 << 24, -1})->Args({1 << 24, 3 << 22})->Args({1 << 27, -1});
+}
+
+BENCHMARK(bm<uint8_t, op::mismatch>)->Apply(parallel_args);
+BENCHMARK(bm<uint8_t, op::par_mismatch>)->Apply(parallel_args);
+BENCHMARK(bm<uint8_t, op::par_equal>)->Apply(parallel_args);
+BENCHMARK(bm<uint8_t, op::par_lexi>)->Apply(parallel_args);
+BENCHMARK(bm<uint32_t, op::par_mismatch>)->Apply(parallel_args);
+BENCHMARK(bm<uint32_t, op::par_lexi>)->Apply(parallel_args);
+
 BENCHMARK_MAIN();
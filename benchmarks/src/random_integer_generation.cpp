@@ -2,8 +2,11 @@
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
 #include <benchmark/benchmark.h>
+#include <cstddef>
 #include <cstdint>
 #include <random>
+#include <type_traits>
+#include <vector>
 
 /// Test URBGs alone
 
@@ -116,4 +119,75 @@ void BM_raw_lcg_new(benchmark::State& state) {
 }
 BENCHMARK(BM_raw_lcg_new);
 
+/// Test ranges::generate_random against filling a buffer one operator() call at a time
+
+template <class Engine>
+void BM_fill_loop(benchmark::State& state) {
+    Engine gen;
+    std::vector<typename Engine::result_type> buf(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (auto& elem : buf) {
+            elem = gen();
+        }
+        benchmark::DoNotOptimize(buf.data());
+    }
+}
+BENCHMARK(BM_fill_loop<std::mt19937>)->Range(64, 1 << 16);
+BENCHMARK(BM_fill_loop<std::mt19937_64>)->Range(64, 1 << 16);
+
+template <class Engine>
+void BM_generate_random(benchmark::State& state) {
+    Engine gen;
+    std::vector<typename Engine::result_type> buf(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::ranges::generate_random(buf, gen);
+        benchmark::DoNotOptimize(buf.data());
+    }
+}
+BENCHMARK(BM_generate_random<std::mt19937>)->Range(64, 1 << 16);
+BENCHMARK(BM_generate_random<std::mt19937_64>)->Range(64, 1 << 16);
+
+template <class Dist>
+Dist make_distribution() {
+    if constexpr (std::is_integral_v<typename Dist::result_type>) {
+        return Dist{0, static_cast<typename Dist::result_type>(maximum)};
+    } else {
+        return Dist{-1, 1};
+    }
+}
+
+template <class Engine, class Dist>
+void BM_dist_fill_loop(benchmark::State& state) {
+    Engine gen;
+    Dist dist = make_distribution<Dist>();
+    std::vector<typename Dist::result_type> buf(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (auto& elem : buf) {
+            elem = dist(gen);
+        }
+        benchmark::DoNotOptimize(buf.data());
+    }
+}
+BENCHMARK(BM_dist_fill_loop<std::mt19937, std::uniform_int_distribution<int>>)->Range(64, 1 << 16);
+BENCHMARK(BM_dist_fill_loop<std::mt19937_64, std::uniform_int_distribution<long long>>)->Range(64, 1 << 16);
+BENCHMARK(BM_dist_fill_loop<std::mt19937, std::uniform_real_distribution<float>>)->Range(64, 1 << 16);
+BENCHMARK(BM_dist_fill_loop<std::mt19937, std::uniform_real_distribution<double>>)->Range(64, 1 << 16);
+BENCHMARK(BM_dist_fill_loop<std::mt19937_64, std::uniform_real_distribution<double>>)->Range(64, 1 << 16);
+
+template <class Engine, class Dist>
+void BM_dist_generate_random(benchmark::State& state) {
+    Engine gen;
+    Dist dist = make_distribution<Dist>();
+    std::vector<typename Dist::result_type> buf(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::ranges::generate_random(buf, gen, dist);
+        benchmark::DoNotOptimize(buf.data());
+    }
+}
+BENCHMARK(BM_dist_generate_random<std::mt19937, std::uniform_int_distribution<int>>)->Range(64, 1 << 16);
+BENCHMARK(BM_dist_generate_random<std::mt19937_64, std::uniform_int_distribution<long long>>)->Range(64, 1 << 16);
+BENCHMARK(BM_dist_generate_random<std::mt19937, std::uniform_real_distribution<float>>)->Range(64, 1 << 16);
+BENCHMARK(BM_dist_generate_random<std::mt19937, std::uniform_real_distribution<double>>)->Range(64, 1 << 16);
+BENCHMARK(BM_dist_generate_random<std::mt19937_64, std::uniform_real_distribution<double>>)->Range(64, 1 << 16);
+
 BENCHMARK_MAIN();
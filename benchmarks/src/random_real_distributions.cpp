@@ -0,0 +1,30 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+#include <random>
+
+template <class Engine, class Dist>
+void BM_distribution(benchmark::State& state) {
+    Engine gen;
+    Dist dist;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dist(gen));
+    }
+}
+
+BENCHMARK(BM_distribution<std::mt19937, std::normal_distribution<float>>);
+BENCHMARK(BM_distribution<std::mt19937, stdext::ziggurat_normal_distribution<float>>);
+BENCHMARK(BM_distribution<std::mt19937_64, std::normal_distribution<double>>);
+BENCHMARK(BM_distribution<std::mt19937_64, stdext::ziggurat_normal_distribution<double>>);
+BENCHMARK(BM_distribution<std::mt19937, std::normal_distribution<double>>);
+BENCHMARK(BM_distribution<std::mt19937, stdext::ziggurat_normal_distribution<double>>);
+
+BENCHMARK(BM_distribution<std::mt19937, std::exponential_distribution<float>>);
+BENCHMARK(BM_distribution<std::mt19937, stdext::ziggurat_exponential_distribution<float>>);
+BENCHMARK(BM_distribution<std::mt19937_64, std::exponential_distribution<double>>);
+BENCHMARK(BM_distribution<std::mt19937_64, stdext::ziggurat_exponential_distribution<double>>);
+BENCHMARK(BM_distribution<std::mt19937, std::exponential_distribution<double>>);
+BENCHMARK(BM_distribution<std::mt19937, stdext::ziggurat_exponential_distribution<double>>);
+
+BENCHMARK_MAIN();
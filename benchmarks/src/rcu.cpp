@@ -0,0 +1,73 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <array>
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <mutex>
+#include <rcu>
+#include <shared_mutex>
+
+// Readers look up entries of a small table that a writer occasionally replaces, as with configuration or routing
+// tables. RCU readers only write to their own thread's state; shared_mutex readers all write the same lock word.
+
+namespace {
+    constexpr std::size_t table_size = 256;
+    constexpr int write_period       = 1024; // thread 0 writes once per this many lookups
+
+    struct table : std::rcu_obj_base<table> {
+        std::array<int, table_size> entries{};
+    };
+
+    std::atomic<table*> published{new table};
+
+    table locked_table;
+    std::shared_mutex table_mutex;
+
+    void BM_rcu(benchmark::State& state) {
+        const bool writer = state.thread_index() == 0;
+        std::size_t key   = static_cast<std::size_t>(state.thread_index());
+        int until_write   = write_period;
+
+        for (auto _ : state) {
+            key = (key + 7) % table_size;
+            {
+                std::scoped_lock lock{std::rcu_default_domain()};
+                benchmark::DoNotOptimize(published.load(std::memory_order_acquire)->entries[key]);
+            }
+
+            if (writer && --until_write == 0) {
+                until_write     = write_period;
+                const auto copy = new table{*published.load(std::memory_order_relaxed)};
+                ++copy->entries[key];
+                published.exchange(copy, std::memory_order_acq_rel)->retire();
+            }
+        }
+    }
+
+    void BM_shared_mutex(benchmark::State& state) {
+        const bool writer = state.thread_index() == 0;
+        std::size_t key   = static_cast<std::size_t>(state.thread_index());
+        int until_write   = write_period;
+
+        for (auto _ : state) {
+            key = (key + 7) % table_size;
+            {
+                std::shared_lock lock{table_mutex};
+                benchmark::DoNotOptimize(locked_table.entries[key]);
+            }
+
+            if (writer && --until_write == 0) {
+                until_write = write_period;
+                std::scoped_lock lock{table_mutex};
+                ++locked_table.entries[key];
+            }
+        }
+    }
+} // namespace
+
+BENCHMARK(BM_rcu)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(BM_shared_mutex)->ThreadRange(1, 16)->UseRealTime();
+
+BENCHMARK_MAIN();
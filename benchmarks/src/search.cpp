@@ -184,10 +184,61 @@ void member_rfind(benchmark::State& state) {
     }
 }
 
+// Searches 4 MiB of text for a token that occurs only at its end, like looking for a request ID in a log.
+// state.range(0) is the length of the token, which starts with text that occurs throughout the haystack.
+template <class T>
+void make_long_haystack(T& haystack, T& needle, const size_t needle_size) {
+    while (haystack.size() < (size_t{4} << 20)) {
+        haystack.append(lorem_ipsum.begin(), lorem_ipsum.end());
+    }
+
+    const auto prefix = lorem_ipsum.substr(100, needle_size - 1);
+    needle.assign(prefix.begin(), prefix.end());
+    needle.push_back('#');
+    haystack += needle;
+}
+
+template <class T>
+void member_find_long_haystack(benchmark::State& state) {
+    T haystack;
+    T needle;
+    make_long_haystack(haystack, needle, static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(haystack);
+        benchmark::DoNotOptimize(needle);
+        auto res = haystack.find(needle);
+        benchmark::DoNotOptimize(res);
+    }
+
+    state.SetBytesProcessed(
+        static_cast<std::int64_t>(state.iterations() * haystack.size() * sizeof(typename T::value_type)));
+}
+
+void search_horspool_searcher_long_haystack(benchmark::State& state) {
+    not_highly_aligned_string haystack;
+    not_highly_aligned_string needle;
+    make_long_haystack(haystack, needle, static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(haystack);
+        benchmark::DoNotOptimize(needle);
+        auto res = std::search(
+            haystack.begin(), haystack.end(), std::boyer_moore_horspool_searcher{needle.begin(), needle.end()});
+        benchmark::DoNotOptimize(res);
+    }
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * haystack.size()));
+}
+
 void common_args(auto bm) {
     bm->DenseRange(0, std::size(patterns) - 1, 1);
 }
 
+void long_haystack_args(auto bm) {
+    bm->ArgName("needle")->Arg(8)->Arg(16)->Arg(32)->Arg(64)->Arg(256)->Arg(1024);
+}
+
 BENCHMARK(c_strstr)->Apply(common_args);
 
 BENCHMARK(classic_search<std::uint8_t>)->Apply(common_args);
@@ -209,6 +260,10 @@ BENCHMARK(member_find<not_highly_aligned_string>)->Apply(common_args);
 BENCHMARK(member_find<not_highly_aligned_wstring>)->Apply(common_args);
 BENCHMARK(member_find<not_highly_aligned_u32string>)->Apply(common_args);
 
+BENCHMARK(member_find_long_haystack<not_highly_aligned_string>)->Apply(long_haystack_args);
+BENCHMARK(member_find_long_haystack<not_highly_aligned_wstring>)->Apply(long_haystack_args);
+BENCHMARK(search_horspool_searcher_long_haystack)->Apply(long_haystack_args);
+
 BENCHMARK(classic_find_end<std::uint8_t>)->Apply(common_args);
 BENCHMARK(classic_find_end<std::uint16_t>)->Apply(common_args);
 BENCHMARK(classic_find_end<std::uint32_t>)->Apply(common_args);
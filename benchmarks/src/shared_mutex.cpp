@@ -0,0 +1,54 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <array>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <mutex>
+#include <shared_mutex>
+
+// Threads look up entries of a small table; thread 0 updates it once per state.range(0) lookups (never, for 0).
+
+namespace {
+    constexpr std::size_t table_size = 64;
+
+    template <class Mutex>
+    struct guarded_table {
+        Mutex mtx;
+        std::array<long long, table_size> entries{};
+    };
+
+    template <class Mutex>
+    guarded_table<Mutex> shared_table;
+
+    template <class Mutex>
+    void BM_read_mostly(benchmark::State& state) {
+        auto& table             = shared_table<Mutex>;
+        const auto write_period = static_cast<long long>(state.range(0));
+        const bool writer       = state.thread_index() == 0 && write_period != 0;
+        std::size_t key         = static_cast<std::size_t>(state.thread_index());
+        long long until_write   = write_period;
+
+        for (auto _ : state) {
+            key = (key + 7) % table_size;
+            if (writer && --until_write == 0) {
+                until_write = write_period;
+                std::scoped_lock lock{table.mtx};
+                ++table.entries[key];
+            } else {
+                std::shared_lock lock{table.mtx};
+                benchmark::DoNotOptimize(table.entries[key]);
+            }
+        }
+    }
+} // namespace
+
+void common_args(auto bm) {
+    bm->ArgName("write_period")->Arg(0)->Arg(1000)->Arg(100)->Arg(10);
+    bm->ThreadRange(1, 32)->UseRealTime();
+}
+
+BENCHMARK(BM_read_mostly<std::shared_mutex>)->Apply(common_args);
+BENCHMARK(BM_read_mostly<stdext::distributed_shared_mutex>)->Apply(common_args);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,40 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <numeric>
+#include <random>
+#include <vector>
+
+template <class T>
+void BM_serial(benchmark::State& state) {
+    std::vector<T> v(static_cast<std::size_t>(state.range(0)));
+    std::iota(v.begin(), v.end(), T{});
+    std::mt19937_64 gen;
+    for (auto _ : state) {
+        std::shuffle(v.begin(), v.end(), gen);
+        benchmark::DoNotOptimize(v.data());
+    }
+}
+
+template <class T>
+void BM_par(benchmark::State& state) {
+    std::vector<T> v(static_cast<std::size_t>(state.range(0)));
+    std::iota(v.begin(), v.end(), T{});
+    std::mt19937_64 gen;
+    for (auto _ : state) {
+        std::shuffle(std::execution::par, v.begin(), v.end(), gen);
+        benchmark::DoNotOptimize(v.data());
+    }
+}
+
+BENCHMARK(BM_serial<std::uint32_t>)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK(BM_par<std::uint32_t>)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK(BM_serial<std::uint64_t>)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK(BM_par<std::uint64_t>)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,70 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+// Reads text made of lines of about state.range(0) characters, a line at a time with getline and a word at a time
+// with operator>>.
+
+namespace {
+    string make_text(const size_t line_length) {
+        mt19937 gen{1729};
+        uniform_int_distribution<int> letter{'a', 'z'};
+        uniform_int_distribution<size_t> word_length{1, 12};
+
+        string text;
+        while (text.size() < (size_t{1} << 20)) {
+            for (size_t line = 0; line < line_length;) {
+                const size_t n = word_length(gen);
+                for (size_t i = 0; i < n; ++i) {
+                    text.push_back(static_cast<char>(letter(gen)));
+                }
+
+                text.push_back(' ');
+                line += n + 1;
+            }
+
+            text.back() = '\n';
+        }
+
+        return text;
+    }
+
+    void BM_getline(benchmark::State& state) {
+        const string text = make_text(static_cast<size_t>(state.range(0)));
+        string line;
+        for (auto _ : state) {
+            istringstream is{text};
+            while (getline(is, line)) {
+                benchmark::DoNotOptimize(line);
+            }
+        }
+
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * text.size()));
+    }
+
+    void BM_extract_words(benchmark::State& state) {
+        const string text = make_text(static_cast<size_t>(state.range(0)));
+        string word;
+        for (auto _ : state) {
+            istringstream is{text};
+            while (is >> word) {
+                benchmark::DoNotOptimize(word);
+            }
+        }
+
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * text.size()));
+    }
+} // namespace
+
+BENCHMARK(BM_getline)->Arg(16)->Arg(80)->Arg(1000)->Arg(100000);
+BENCHMARK(BM_extract_words)->Arg(80);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,81 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include "lorem.hpp"
+
+// This is built twice: as benchmark-string_hash with the original byte-at-a-time FNV-1a hash, and as
+// benchmark-string_hash_wordwise with _MSVC_STL_WORDWISE_HASH defined, to compare the two.
+
+namespace {
+    template <class CharT>
+    std::basic_string<CharT> make_key(const std::size_t length) {
+        std::basic_string<CharT> key;
+        while (key.size() < length) {
+            key.append(lorem_ipsum.begin(), lorem_ipsum.end());
+        }
+
+        key.resize(length);
+        return key;
+    }
+
+    template <class CharT>
+    void BM_hash(benchmark::State& state) {
+        const auto length = static_cast<std::size_t>(state.range(0));
+        const auto key    = make_key<CharT>(length);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(key);
+            benchmark::DoNotOptimize(std::hash<std::basic_string_view<CharT>>{}(key));
+        }
+
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * length * sizeof(CharT)));
+    }
+
+    void BM_hash_path(benchmark::State& state) {
+        const std::filesystem::path file{L"C:\\Program Files\\Microsoft Visual Studio\\2022\\Community\\VC\\Tools"
+                                         L"\\MSVC\\14.44.35207\\include\\type_traits"};
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(file);
+            benchmark::DoNotOptimize(std::hash<std::filesystem::path>{}(file));
+        }
+    }
+
+    // Lookups of short identifiers, such as symbol or field names, which are mostly hashing.
+    void BM_find_identifier(benchmark::State& state) {
+        const auto length = static_cast<std::size_t>(state.range(0));
+        std::vector<std::string> keys;
+        for (std::size_t i = 0; i < 4096; ++i) {
+            std::string key = "id_" + std::to_string(i);
+            key.resize(length, '_');
+            keys.push_back(key);
+        }
+
+        const std::unordered_set<std::string> identifiers(keys.begin(), keys.end());
+        std::size_t i = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(identifiers.find(keys[i]));
+            i = (i + 1) % keys.size();
+        }
+    }
+} // namespace
+
+void key_lengths(auto bm) {
+    bm->ArgName("length")->RangeMultiplier(4)->Range(4, 4096);
+    bm->Arg(7)->Arg(12)->Arg(24)->Arg(40);
+}
+
+BENCHMARK(BM_hash<char>)->Apply(key_lengths);
+BENCHMARK(BM_hash<wchar_t>)->Apply(key_lengths);
+BENCHMARK(BM_hash_path);
+BENCHMARK(BM_find_identifier)->ArgName("length")->Arg(8)->Arg(16)->Arg(32);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,60 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+namespace {
+    template <class Resource>
+    Resource shared_pool;
+
+    template <class Resource>
+    void BM_alloc_free(benchmark::State& state) {
+        // each thread allocates a batch of message-sized objects and frees them again
+        auto& pool      = shared_pool<Resource>;
+        const auto size = static_cast<std::size_t>(state.range(0));
+        std::vector<void*> ptrs(64);
+        for (auto _ : state) {
+            for (auto& ptr : ptrs) {
+                ptr = pool.allocate(size, alignof(std::max_align_t));
+            }
+
+            benchmark::DoNotOptimize(ptrs.data());
+            for (const auto ptr : ptrs) {
+                pool.deallocate(ptr, size, alignof(std::max_align_t));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<long long>(ptrs.size()));
+    }
+
+    template <class Resource>
+    void BM_pmr_vector(benchmark::State& state) {
+        // node and buffer churn through a pmr container
+        for (auto _ : state) {
+            std::pmr::vector<std::pmr::vector<int>> outer{&shared_pool<Resource>};
+            for (int i = 0; i < 32; ++i) {
+                outer.emplace_back(static_cast<std::size_t>(i), i);
+            }
+
+            benchmark::DoNotOptimize(outer.data());
+        }
+    }
+} // namespace
+
+void size_args(auto bm) {
+    bm->Arg(24)->Arg(64)->Arg(256)->ThreadRange(1, 32)->UseRealTime();
+}
+
+void thread_args(auto bm) {
+    bm->ThreadRange(1, 32)->UseRealTime();
+}
+
+BENCHMARK(BM_alloc_free<std::pmr::synchronized_pool_resource>)->Apply(size_args);
+BENCHMARK(BM_alloc_free<stdext::pmr::thread_caching_pool_resource>)->Apply(size_args);
+BENCHMARK(BM_pmr_vector<std::pmr::synchronized_pool_resource>)->Apply(thread_args);
+BENCHMARK(BM_pmr_vector<stdext::pmr::thread_caching_pool_resource>)->Apply(thread_args);
+
+BENCHMARK_MAIN();
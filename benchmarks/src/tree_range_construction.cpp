@@ -0,0 +1,92 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <map>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+// Builds maps and sets from a range of sorted, nearly sorted (1% of the elements swapped), or random keys, as when
+// loading exports or snapshots. BM_element_wise inserts the same keys one at a time at end(), the fastest way to do it
+// without range construction.
+
+enum class order { sorted, nearly_sorted, random };
+
+std::vector<std::pair<int, int>> make_pairs(const std::size_t count, const order ord) {
+    std::vector<std::pair<int, int>> v;
+    v.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        v.emplace_back(static_cast<int>(i), static_cast<int>(i));
+    }
+
+    std::mt19937 gen{1729};
+    if (ord == order::nearly_sorted) {
+        std::uniform_int_distribution<std::size_t> dist{0, count - 1};
+        for (std::size_t i = 0; i < count / 100; ++i) {
+            std::swap(v[dist(gen)], v[dist(gen)]);
+        }
+    } else if (ord == order::random) {
+        std::shuffle(v.begin(), v.end(), gen);
+    }
+
+    return v;
+}
+
+template <order Ord>
+void BM_map_from_range(benchmark::State& state) {
+    const auto v = make_pairs(static_cast<std::size_t>(state.range(0)), Ord);
+    for (auto _ : state) {
+        std::map<int, int> m(v.begin(), v.end());
+        benchmark::DoNotOptimize(m);
+    }
+}
+
+template <order Ord>
+void BM_element_wise(benchmark::State& state) {
+    const auto v = make_pairs(static_cast<std::size_t>(state.range(0)), Ord);
+    for (auto _ : state) {
+        std::map<int, int> m;
+        for (const auto& p : v) {
+            m.emplace_hint(m.end(), p);
+        }
+
+        benchmark::DoNotOptimize(m);
+    }
+}
+
+template <order Ord>
+void BM_multiset_insert(benchmark::State& state) {
+    const auto pairs = make_pairs(static_cast<std::size_t>(state.range(0)), Ord);
+    std::vector<int> v;
+    for (const auto& p : pairs) {
+        v.push_back(p.first / 4); // runs of equivalent keys
+    }
+
+    for (auto _ : state) {
+        std::multiset<int> s;
+        s.insert(v.begin(), v.end());
+        benchmark::DoNotOptimize(s);
+    }
+}
+
+void common_args(auto bm) {
+    bm->RangeMultiplier(64)->Range(64, 1 << 18);
+}
+
+BENCHMARK(BM_map_from_range<order::sorted>)->Apply(common_args);
+BENCHMARK(BM_map_from_range<order::nearly_sorted>)->Apply(common_args);
+BENCHMARK(BM_map_from_range<order::random>)->Apply(common_args);
+
+BENCHMARK(BM_element_wise<order::sorted>)->Apply(common_args);
+BENCHMARK(BM_element_wise<order::nearly_sorted>)->Apply(common_args);
+BENCHMARK(BM_element_wise<order::random>)->Apply(common_args);
+
+BENCHMARK(BM_multiset_insert<order::sorted>)->Apply(common_args);
+BENCHMARK(BM_multiset_insert<order::nearly_sorted>)->Apply(common_args);
+BENCHMARK(BM_multiset_insert<order::random>)->Apply(common_args);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,94 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Caches keyed by long strings that share a prefix, such as URLs or file paths.
+
+namespace {
+    template <template <class> class Alloc>
+    using string_map = std::unordered_map<std::string, int, std::hash<std::string>, std::equal_to<std::string>,
+        Alloc<std::pair<const std::string, int>>>;
+
+    std::vector<std::string> make_keys(const std::size_t count, const char* const tag) {
+        std::vector<std::string> keys;
+        keys.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            keys.push_back("https://example.com/some/fairly/long/common/prefix/" + std::to_string(i) + tag);
+        }
+
+        return keys;
+    }
+
+    template <template <class> class Alloc>
+    string_map<Alloc> make_map(const std::vector<std::string>& keys) {
+        string_map<Alloc> m;
+        int value = 0;
+        for (const auto& key : keys) {
+            m.emplace(key, value++);
+        }
+
+        return m;
+    }
+
+    template <template <class> class Alloc>
+    void BM_rehash(benchmark::State& state) {
+        const auto m = make_map<Alloc>(make_keys(static_cast<std::size_t>(state.range(0)), ""));
+        for (auto _ : state) {
+            state.PauseTiming();
+            string_map<Alloc> copy{m}; // copies have the same bucket count
+            state.ResumeTiming();
+            copy.rehash(copy.bucket_count() * 2);
+            benchmark::DoNotOptimize(copy);
+            state.PauseTiming();
+            copy = string_map<Alloc>{}; // frees the elements untimed
+            state.ResumeTiming();
+        }
+    }
+
+    template <template <class> class Alloc>
+    void BM_find_miss(benchmark::State& state) {
+        const auto count  = static_cast<std::size_t>(state.range(0));
+        const auto m      = make_map<Alloc>(make_keys(count, ""));
+        const auto misses = make_keys(count, "/missing");
+        std::size_t i     = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(m.find(misses[i]));
+            if (++i == count) {
+                i = 0;
+            }
+        }
+    }
+
+    template <template <class> class Alloc>
+    void BM_find_hit(benchmark::State& state) {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        const auto keys  = make_keys(count, "");
+        const auto m     = make_map<Alloc>(keys);
+        std::size_t i    = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(m.find(keys[i]));
+            if (++i == count) {
+                i = 0;
+            }
+        }
+    }
+} // namespace
+
+BENCHMARK(BM_rehash<std::allocator>)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_rehash<stdext::hash_caching_allocator>)->Arg(1 << 10)->Arg(1 << 16);
+
+BENCHMARK(BM_find_miss<std::allocator>)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_find_miss<stdext::hash_caching_allocator>)->Arg(1 << 10)->Arg(1 << 16);
+
+BENCHMARK(BM_find_hit<std::allocator>)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_find_hit<stdext::hash_caching_allocator>)->Arg(1 << 10)->Arg(1 << 16);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,75 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#define _MSVC_STL_ALLOCATOR_EXPAND_IN_PLACE 1
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// std::allocator tries to extend blocks in place with _expand() before containers reallocate.
+// plain_allocator is the same allocator without that hook, so growth always allocates, moves, and frees.
+template <class T>
+struct plain_allocator : allocator<T> {
+    plain_allocator() = default;
+
+    template <class U>
+    plain_allocator(const plain_allocator<U>&) noexcept {}
+};
+
+template <class Alloc>
+void vector_push_back(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state) {
+        vector<int, Alloc> vec;
+        for (size_t i = 0; i != n; ++i) {
+            vec.push_back(static_cast<int>(i));
+        }
+
+        benchmark::DoNotOptimize(vec.data());
+    }
+}
+
+template <class Alloc>
+void vector_resize_by_steps(benchmark::State& state) {
+    const auto n    = static_cast<size_t>(state.range(0));
+    const auto step = n / 16;
+
+    for (auto _ : state) {
+        vector<double, Alloc> vec;
+        for (size_t size = step; size <= n; size += step) {
+            vec.resize(size);
+            benchmark::DoNotOptimize(vec.data());
+        }
+    }
+}
+
+template <class Alloc>
+void string_push_back(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state) {
+        basic_string<char, char_traits<char>, Alloc> str;
+        for (size_t i = 0; i != n; ++i) {
+            str.push_back('x');
+        }
+
+        benchmark::DoNotOptimize(str.data());
+    }
+}
+
+BENCHMARK(vector_push_back<allocator<int>>)->Range(1 << 12, 1 << 24);
+BENCHMARK(vector_push_back<plain_allocator<int>>)->Range(1 << 12, 1 << 24);
+
+BENCHMARK(vector_resize_by_steps<allocator<double>>)->Range(1 << 12, 1 << 24);
+BENCHMARK(vector_resize_by_steps<plain_allocator<double>>)->Range(1 << 12, 1 << 24);
+
+BENCHMARK(string_push_back<allocator<char>>)->Range(1 << 12, 1 << 24);
+BENCHMARK(string_push_back<plain_allocator<char>>)->Range(1 << 12, 1 << 24);
+
+BENCHMARK_MAIN();
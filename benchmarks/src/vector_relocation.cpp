@@ -0,0 +1,79 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+// std::string and std::unique_ptr are trivially relocatable, so vector moves them to new storage with memmove.
+// wrapped<T> is not, so vector moves and destroys each element individually.
+template <class T>
+struct wrapped {
+    T value;
+};
+
+void make_element(string& out) {
+    out.assign(8, 'x');
+}
+
+void make_element(unique_ptr<int>& out) {
+    out = make_unique<int>(1729);
+}
+
+template <class T>
+void make_element(wrapped<T>& out) {
+    make_element(out.value);
+}
+
+template <class T>
+void push_back_growing(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    T elem;
+    make_element(elem);
+
+    for (auto _ : state) {
+        vector<T> vec;
+        for (size_t i = 0; i != n; ++i) {
+            if constexpr (is_copy_constructible_v<T>) {
+                vec.push_back(elem);
+            } else {
+                vec.emplace_back();
+                make_element(vec.back());
+            }
+        }
+
+        benchmark::DoNotOptimize(vec.data());
+    }
+}
+
+template <class T>
+void insert_erase_front(benchmark::State& state) {
+    vector<T> vec(static_cast<size_t>(state.range(0)));
+    for (auto& elem : vec) {
+        make_element(elem);
+    }
+
+    for (auto _ : state) {
+        vec.emplace(vec.begin());
+        benchmark::DoNotOptimize(vec.data());
+        vec.erase(vec.begin());
+        benchmark::DoNotOptimize(vec.data());
+    }
+}
+
+BENCHMARK(push_back_growing<string>)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(push_back_growing<wrapped<string>>)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(push_back_growing<unique_ptr<int>>)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(push_back_growing<wrapped<unique_ptr<int>>>)->Arg(1 << 10)->Arg(1 << 16);
+
+BENCHMARK(insert_erase_front<string>)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(insert_erase_front<wrapped<string>>)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(insert_erase_front<unique_ptr<int>>)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(insert_erase_front<wrapped<unique_ptr<int>>>)->Arg(1 << 10)->Arg(1 << 16);
+
+BENCHMARK_MAIN();
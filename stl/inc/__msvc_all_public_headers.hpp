@@ -92,6 +92,7 @@
 #include <generator>
 #include <hash_map>
 #include <hash_set>
+#include <hazard_pointer>
 #include <iomanip>
 #include <ios>
 #include <iosfwd>
@@ -112,6 +113,7 @@
 #include <queue>
 #include <random>
 #include <ranges>
+#include <rcu>
 #include <regex>
 #include <scoped_allocator>
 #include <set>
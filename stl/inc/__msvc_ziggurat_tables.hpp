@@ -0,0 +1,246 @@
+// __msvc_ziggurat_tables.hpp internal header
+
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef __MSVC_ZIGGURAT_TABLES_HPP
+#define __MSVC_ZIGGURAT_TABLES_HPP
+#include <yvals_core.h>
+#if _STL_COMPILER_PREPROCESSOR
+
+#pragma pack(push, _CRT_PACKING)
+#pragma warning(push, _STL_WARNING_LEVEL)
+#pragma warning(disable : _STL_DISABLED_WARNINGS)
+_STL_DISABLE_CLANG_WARNINGS
+#pragma push_macro("new")
+#undef new
+
+_STD_BEGIN
+// Layer tables for the 256-layer ziggurats used by stdext::ziggurat_normal_distribution and
+// stdext::ziggurat_exponential_distribution, see G. Marsaglia and W. W. Tsang, "The Ziggurat Method for Generating
+// Random Variables", Journal of Statistical Software 5(8), 2000, and J. A. Doornik, "An Improved Ziggurat Method to
+// Generate Normal Random Samples", 2005.
+//
+// For the unnormalized density f, layer _Idx covers [0, _X[_Idx]) horizontally and [_F[_Idx], _F[_Idx + 1])
+// vertically, where _F[_Idx] == f(_X[_Idx]). Every layer has the same area; layer 0 is the base strip [0, _X[1])
+// together with the tail beyond _X[1], so _X[0] is that area divided by f(_X[1]). _X[256] is 0.
+
+// normal ziggurat, f(x) = exp(-x * x / 2)
+_INLINE_VAR constexpr double _Zig_normal_x[257] = {
+    3.910757959524916, 3.654152885361009, 3.449278298561431, 3.3202447338398255, 3.2245750520478014, 3.147889289518001,
+    3.0835261320021434, 3.0278377917695933, 2.978603279881843, 2.9343668672088876, 2.894121053613412,
+    2.8571387308732246, 2.822877396826443, 2.7909211740019275, 2.760944005279986, 2.7326853590440114, 2.705933656123062,
+    2.680514643285745, 2.6562830375767432, 2.6331163936315827, 2.6109105184888235, 2.5895759867082866,
+    2.569035452681844, 2.5492215503247833, 2.530075232159854, 2.5115444416266945, 2.4935830412710467, 2.476149939670523,
+    2.459208374334705, 2.442725318200364, 2.4266709849371466, 2.4110184139011195, 2.3957431197819274,
+    2.3808227951720857, 2.366237056717291, 2.3519672273791445, 2.337996148796529, 2.3243080188711325, 2.310888250601372,
+    2.2977233489028634, 2.284800802724492, 2.2721089902283818, 2.2596370951737876, 2.247375032947389, 2.235313384929921,
+    2.2234433400925107, 2.211756642884161, 2.2002455466112765, 2.1889027716263607, 2.177721467740293,
+    2.1666951803543086, 2.1558178198767375, 2.145083634047889, 2.134487182846017, 2.1240233156895236, 2.113687150686653,
+    2.1034740557148774, 2.093379631138792, 2.0833996939983046, 2.073530263518743, 2.0637675478117323,
+    2.0541079316506523, 2.0445479652175313, 2.035084353729619, 2.025713947863854, 2.016433734906204, 2.0072408305605287,
+    1.9981324713584196, 1.989106007617438, 1.9801588969004766, 1.9712886979336592, 1.962493064944363,
+    1.9537697423846467, 1.9451165600086784, 1.9365314282756947, 1.9280123340526658, 1.9195573365931882,
+    1.9111645637712533, 1.9028322085504292, 1.8945585256707047, 1.8863418285367828, 1.8781804862929958,
+    1.8700729210712668, 1.8620176053996742, 1.8540130597602018, 1.8460578502851854, 1.8381505865828067,
+    1.830289919682757, 1.8224745400938858, 1.8147031759662826, 1.8069745913508208, 1.7992875845497203,
+    1.7916409865521625, 1.7840336595494415, 1.7764644955245228, 1.7689324149112686, 1.7614363653189102,
+    1.7539753203176716, 1.7465482782817223, 1.7391542612859117, 1.7317923140529632, 1.724461502948045,
+    1.717160915017823, 1.7098896570713018, 1.7026468547999232, 1.6954316519345616, 1.6882432094371953,
+    1.681080704725174, 1.673943330926125, 1.6668302961616654, 1.6597408228581825, 1.652674147083056, 1.6456295179047824,
+    1.6386061967755476, 1.6316034569348736, 1.6246205828330347, 1.6176568695730156, 1.6107116223698301,
+    1.6037841560260946, 1.5968737944227882, 1.5899798700241907, 1.5831017233960292, 1.5762387027359064,
+    1.5693901634151237, 1.562555467531045, 1.5557339834691764, 1.5489250854741734, 1.5421281532290019,
+    1.535342571441514, 1.5285677294377125, 1.521803020760998, 1.5150478427767147, 1.5083015962813116,
+    1.5015636851154637, 1.4948335157804935, 1.4881104970574475, 1.4813940396281873, 1.4746835556978555,
+    1.4679784586180795, 1.4612781625102755, 1.4545820818884103, 1.447889631280576, 1.441200224848724,
+    1.4345132760058923, 1.427828197030256, 1.421144398675309, 1.4144612897754711, 1.407778276846399, 1.401094763679251,
+    1.394410150928141, 1.3877238356899761, 1.3810352110758555, 1.3743436657731662, 1.367648583597476, 1.360949343033283,
+    1.354245316762635, 1.3475358711805872, 1.340820365896404, 1.33409815321936, 1.3273685776279258, 1.3206309752210563,
+    1.3138846731502205, 1.3071289890307312, 1.3003632303308372, 1.2935866937369478, 1.2867986644932436,
+    1.279998415713818, 1.2731852076653563, 1.2663582870182295, 1.2595168860637143, 1.2526602218948972,
+    1.2457874955486272, 1.2388978911056874, 1.2319905747461362, 1.2250646937565308, 1.2181193754854815,
+    1.211153726243699, 1.2041668301443815, 1.1971577478794415, 1.190125515426692, 1.1830691426826867, 1.175987612015452,
+    1.168879876730833, 1.1617448594456115, 1.1545814503599277, 1.147388505420849, 1.1401648443681514,
+    1.1329092486525338, 1.1256204592155334, 1.118297174119345, 1.1109380460135758, 1.1035416794246398,
+    1.0961066278520215, 1.0886313906539797, 1.0811144097034038, 1.0735540657924363, 1.0659486747621225,
+    1.0582964833306752, 1.05059566459093, 1.042844313144149, 1.035040439833441, 1.0271819660356458, 1.0192667174654841,
+    1.0112924174399958, 1.003256679544673, 0.995156999635091, 0.9869907470990624, 0.9787551552942246,
+    0.9704473110642244, 0.9620641432230406, 0.953602409881086, 0.9450586844681654, 0.9364293402865751,
+    0.9277105334020002, 0.9188981836495906, 0.9099879534967185, 0.9009752244612218, 0.8918550707329416,
+    0.8826222295851656, 0.8732710680888608, 0.8637955455533088, 0.8541891710081638, 0.8444449549091539,
+    0.8345553540863822, 0.8245122087522921, 0.8143066701352152, 0.8039291169899713, 0.7933690588406233,
+    0.7826150233072331, 0.7716544242245681, 0.7604734064301081, 0.7490566620178153, 0.7373872114342956,
+    0.7254461409099996, 0.7132122851909759, 0.7006618411068151, 0.6877678927957885, 0.6744998228372938,
+    0.6608225742444197, 0.6466957148949938, 0.6320722363860611, 0.6168969900077514, 0.6011046177559927,
+    0.5846167661063794, 0.5673382570538188, 0.5491517023271651, 0.5299097206615582, 0.5094233296020918,
+    0.487443966139236, 0.46363433679088223, 0.4375184022078717, 0.40838913461199117, 0.37512133287838056,
+    0.33573751921442524, 0.2861745917920725, 0.2152418959848817, 0.0};
+
+_INLINE_VAR constexpr double _Zig_normal_f[257] = {
+    0.00047746776460938755, 0.0012602859304985975, 0.002609072746102163, 0.0040379725933630305, 0.005522403299250998,
+    0.007050875471373227, 0.008616582769398732, 0.010214971439701471, 0.01184275785790789, 0.01349745060173988,
+    0.015177088307935327, 0.01688008315254317, 0.018605121275724647, 0.02035109623004452, 0.022117062707308868,
+    0.023902203305795882, 0.025705804008548896, 0.027527235669603085, 0.029365939758133317, 0.03122141719192025,
+    0.03309321945857852, 0.034980941461716084, 0.03688421568856729, 0.03880270740452612, 0.04073611065594093,
+    0.04268414491647444, 0.04464655225129445, 0.04662309490193037, 0.04861355321586853, 0.05061772386094777,
+    0.05263541827679218, 0.05466646132488892, 0.0567106901062029, 0.058767952920933765, 0.060838108349539864,
+    0.06292102443775813, 0.06501657797124286, 0.0671246538277885, 0.06924514439700677, 0.07137794905889037,
+    0.07352297371398127, 0.07568013035892708, 0.07784933670209605, 0.08003051581466306, 0.08222359581320286,
+    0.08442850957035337, 0.08664519445055796, 0.0888735920682758, 0.09111364806637363, 0.09336531191269087,
+    0.09562853671300883, 0.0979032790388623, 0.10018949876880982, 0.1024871589419351, 0.1047962256224869,
+    0.10711666777468365, 0.10944845714681165, 0.111791568163838, 0.11414597782783836, 0.11651166562561081,
+    0.11888861344290999, 0.12127680548479022, 0.12367622820159656, 0.12608687022018586, 0.12850872227999954,
+    0.13094177717364433, 0.13338602969166913, 0.13584147657125373, 0.13830811644855073, 0.1407859498144447,
+    0.14327497897351343, 0.14577520800599406, 0.14828664273257455, 0.1508092906818457, 0.15334316106026286,
+    0.15588826472447923, 0.1584446141559243, 0.1610122234375111, 0.16359110823236572, 0.16618128576448207,
+    0.1687827748012115, 0.17139559563750595, 0.17401977008183878, 0.176655321443735, 0.17930227452284767,
+    0.18196065559952257, 0.18463049242679927, 0.18731181422380028, 0.19000465167046499, 0.19270903690358915,
+    0.19542500351413428, 0.19815258654577514, 0.2008918224946566, 0.20364274931033488, 0.20640540639788074,
+    0.20917983462112502, 0.21196607630703018, 0.2147641752511736, 0.21757417672433116, 0.22039612748015197,
+    0.22323007576391746, 0.22607607132238022, 0.22893416541468026, 0.2318044108243386, 0.23468686187232993,
+    0.23758157443123798, 0.24048860594050042, 0.24340801542275015, 0.24633986350126366, 0.24928421241852827,
+    0.25224112605594196, 0.2552106699546617, 0.25819291133761896, 0.2611879191327209, 0.2641957639972608,
+    0.26721651834356114, 0.27025025636587524, 0.2732970540685769, 0.2763569892956681, 0.2794301417616378,
+    0.28251659308370747, 0.2856164268155016, 0.28872972848218276, 0.29185658561709504, 0.2949970877999617,
+    0.29815132669668537, 0.30131939610080294, 0.3045013919766498, 0.30769741250429195, 0.31090755812628634,
+    0.3141319315963371, 0.3173706380299135, 0.32062378495690536, 0.3238914823763911, 0.32717384281360135,
+    0.3304709813791634, 0.3337830158307183, 0.33711006663700593, 0.3404522570445217, 0.3438097131468506,
+    0.34718256395679353, 0.35057094148140594, 0.3539749808000766, 0.3573948201457803, 0.3608306009896478,
+    0.3642824681290038, 0.3677505697790323, 0.3712350576682393, 0.3747360871378909, 0.37825381724561896,
+    0.38178841087339344, 0.3853400348400771, 0.3889088600187886, 0.3924950614593154, 0.39609881851583223,
+    0.39972031498019706, 0.40335973922111434, 0.4070172843294732, 0.41069314827018805, 0.41438753404089096,
+    0.418100649837848, 0.4218327092294958, 0.42558393133802186, 0.4293545410294413, 0.43314476911265215,
+    0.4369548525479854, 0.4407850346658038, 0.4446355653957392, 0.4485067015072028, 0.4523987068618483,
+    0.45631185267871616, 0.46024641781284253, 0.464202689048174, 0.46818096140569326, 0.4721815384677298,
+    0.47620473271950553, 0.4802508659090465, 0.48432026942668294, 0.48841328470545764, 0.4925302636438682,
+    0.4966715690524894, 0.5008375751261485, 0.5050286679434679, 0.5092452459957476, 0.5134877207473266,
+    0.5177565172297559, 0.5220520746723215, 0.526374847171684, 0.5307253044036616, 0.5351039323804572,
+    0.5395112342569517, 0.5439477311900258, 0.5484139632552655, 0.552910490425832, 0.5574378936187656,
+    0.561996775814524, 0.566587763256164, 0.5712115067352528, 0.5758686829723533, 0.5805599961007905,
+    0.5852861792633709, 0.5900479963328256, 0.594846243767987, 0.5996817526191249, 0.6045553906974674,
+    0.6094680649257731, 0.6144207238889136, 0.6194143606058341, 0.6244500155470262, 0.6295287799248364,
+    0.6346517992876233, 0.6398202774530563, 0.6450354808208221, 0.6502987431108165, 0.655611470579697,
+    0.6609751477766629, 0.6663913439087499, 0.6718617198970818, 0.6773880362187731, 0.6829721616449944,
+    0.6886160830046714, 0.6943219161261164, 0.7000919181365113, 0.7059285013327539, 0.7118342488782481,
+    0.7178119326307216, 0.7238645334686298, 0.7299952645614758, 0.7362075981268623, 0.7425052963401507,
+    0.7488924472191565, 0.7553735065070958, 0.7619533468367949, 0.7686373157984858, 0.7754313049811867,
+    0.7823418326548021, 0.7893761435660241, 0.7965423304229586, 0.8038494831709639, 0.8113078743126559,
+    0.818929191603702, 0.826726833946221, 0.8347162929868832, 0.842915653112204, 0.8513462584586777, 0.8600336211963312,
+    0.8690086880368567, 0.8783096558089171, 0.887984660755833, 0.8980959218983431, 0.9087264400521305,
+    0.9199915050393467, 0.9320600759592301, 0.9451989534422993, 0.9598790918001063, 0.9771017012676713, 1.0};
+
+// exponential ziggurat, f(x) = exp(-x)
+_INLINE_VAR constexpr double _Zig_exp_x[257] = {
+    8.69711747013105, 7.69711747013105, 6.941033629377213, 6.47837849383257, 6.144164665772473, 5.8821443157954,
+    5.666410167454034, 5.4828906275260625, 5.323090505754399, 5.181487281301501, 5.054288489981305, 4.938777085901251,
+    4.832939741025113, 4.735242996601741, 4.644491885420085, 4.559737061707351, 4.480211746528422, 4.405287693473573,
+    4.334443680317273, 4.267242480277366, 4.203313713735184, 4.1423408656640515, 4.084051310408298, 4.028208544647937,
+    3.9746060666737884, 3.9230625001354897, 3.873417670399509, 3.8255294185223367, 3.779270992411668,
+    3.7345288940397974, 3.691201090237419, 3.6491955157608538, 3.6084288131289095, 3.5688252656483375,
+    3.530315889129344, 3.49283765477406, 3.4563328211327606, 3.4207483572511204, 3.386035442460302, 3.35214903090011,
+    3.319047470970749, 3.286692171599069, 3.2550473085704503, 3.2240795652862646, 3.1937579032122407,
+    3.1640533580259733, 3.134938858084441, 3.1063890623398245, 3.0783802152540907, 3.0508900166154556,
+    3.0238975044556766, 2.9973829495161306, 2.9713277599210897, 2.9457143948950457, 2.920526286512741,
+    2.895747768600142, 2.8713640120155364, 2.847360965635189, 2.8237253024500353, 2.8004443702507382, 2.777506146439757,
+    2.7548991965623455, 2.732612636194701, 2.710636095867929, 2.688959688741804, 2.667573980773267, 2.6464699631518096,
+    2.6256390267977885, 2.6050729387408356, 2.5847638202141408, 2.5647041263169053, 2.54488662711187, 2.525304390037828,
+    2.505950763528594, 2.48681936174021, 2.467904050297365, 2.4491989329782498, 2.4306983392644197, 2.4123968126888706,
+    2.3942890999214583, 2.376370140536141, 2.3586350574093373, 2.341079147703035, 2.3236978743901964, 2.30648685828358,
+    2.2894418705322694, 2.272558825553155, 2.255833774367219, 2.2392628983129086, 2.2228425031110364,
+    2.2065690132576634, 2.19043896672322, 2.1744490099377747, 2.1585958930438855, 2.1428764653998416, 2.127287671317368,
+    2.1118265460190417, 2.0964902118017146, 2.0812758743932247, 2.0661808194905755, 2.051202409468585,
+    2.0363380802487696, 2.021585338318926, 2.006941757894518, 1.9924049782135764, 1.9779727009573602, 1.963642687789548,
+    1.9494127580071845, 1.9352807862970511, 1.9212447005915276, 1.907302480018387, 1.8934521529393078,
+    1.8796917950722107, 1.8660195276928275, 1.852433515911175, 1.8389319670188793, 1.8255131289035191,
+    1.8121752885263902, 1.7989167704602904, 1.7857359354841253, 1.772631179231305, 1.7596009308890743,
+    1.746643651946074, 1.7337578349855711, 1.720942002521935, 1.7081947058780576, 1.6955145241015377,
+    1.6829000629175537, 1.670349953716452, 1.6578628525741725, 1.6454374393037234, 1.6330724165359911,
+    1.6207665088282577, 1.6085184617988582, 1.5963270412864832, 1.5841910325326887, 1.5721092393862295,
+    1.5600804835278879, 1.5481036037145133, 1.5361774550410319, 1.524300908219226, 1.5124728488721169,
+    1.5006921768428165, 1.4889578055167456, 1.4772686611561334, 1.4656236822457451, 1.4540218188487932,
+    1.4424620319720123, 1.4309432929388795, 1.4194645827699828, 1.4080248915695353, 1.3966232179170417,
+    1.3852585682631218, 1.3739299563284901, 1.3626364025050866, 1.351376933258335, 1.3401505805295046,
+    1.3289563811371163, 1.3177933761763245, 1.306660610415174, 1.2955571316866008, 1.2844819902750126,
+    1.2734342382962411, 1.2624129290696153, 1.2514171164808525, 1.2404458543344064, 1.229498195693849,
+    1.2185731922087903, 1.2076698934267613, 1.196787346088403, 1.1859245934042024, 1.1750806743109117,
+    1.1642546227056791, 1.1534454666557747, 1.1426522275816728, 1.1318739194110787, 1.1211095477013306,
+    1.1103581087274115, 1.0996185885325978, 1.0888899619385473, 1.0781711915113728, 1.067461226479968,
+    1.0567590016025519, 1.0460634359770447, 1.035373431790529, 1.0246878730026179, 1.0140056239570971,
+    1.0033255279156974, 0.9926464055072765, 0.9819670530850632, 0.9712862409839039, 0.9606027116686671,
+    0.9499151777640766, 0.939222319955263, 0.9285227847472112, 0.917815182070045, 0.907098082715691, 0.8963700155898907,
+    0.8856294647617523, 0.8748748662910258, 0.8641046048110052, 0.853317009842374, 0.8425103518103693,
+    0.8316828377342739, 0.8208326065544125, 0.8099577240574191, 0.7990561773554878, 0.7881258688694932,
+    0.7771646097591305, 0.7661701127354354, 0.7551399841819829, 0.7440717155005088, 0.7329626735843661,
+    0.7218100903087569, 0.7106110509096557, 0.6993624811032326, 0.6880611327737486, 0.6767035680295234,
+    0.6652861413926786, 0.6538049798476656, 0.642255960424537, 0.630634684933491, 0.6189364513948767,
+    0.6071562216203008, 0.5952885842915036, 0.5833277127487703, 0.571267316532589, 0.5591005855115413,
+    0.5468201251633111, 0.5344178812371662, 0.5218850515921356, 0.509211982443655, 0.4963880455186716,
+    0.48340149165346225, 0.47023927508216945, 0.45688684093142073, 0.44332786607355296, 0.4295439402254113,
+    0.415514169600357, 0.4012146788962784, 0.38661797794112024, 0.37169214532991784, 0.3563997602583944,
+    0.3406964810648498, 0.32452911701691006, 0.3078329546749329, 0.29052795549123117, 0.2725131854784655,
+    0.25365836338591286, 0.23379048305967554, 0.21267151063096745, 0.18995868962243279, 0.1651276225641883,
+    0.1373049809400138, 0.10483850756582018, 0.06385216381500348, 0.0};
+
+_INLINE_VAR constexpr double _Zig_exp_f[257] = {
+    0.0001670666923079639, 0.00045413435384149677, 0.0009672692823271745, 0.0015362997803015724, 0.0021459677437189063,
+    0.002788798793574076, 0.003460264777836904, 0.004157295120833795, 0.004877655983542392, 0.005619642207205483,
+    0.006381905937319179, 0.007163353183634984, 0.00796307743801704, 0.008780314985808975, 0.00961441364250221,
+    0.010464810181029979, 0.011331013597834597, 0.012212592426255381, 0.013109164931254991, 0.014020391403181938,
+    0.014945968011691148, 0.015885621839973163, 0.016839106826039948, 0.01780620041091136, 0.01878670074469603,
+    0.019780424338009743, 0.020787204072578117, 0.02180688750428358, 0.02283933540638524, 0.02388442051155817,
+    0.024942026419731783, 0.026012046645134217, 0.0270943837809558, 0.028188948763978636, 0.029295660224637393,
+    0.030414443910466604, 0.03154523217289361, 0.032687963508959535, 0.03384258215087433, 0.03500903769739741,
+    0.03618728478193142, 0.03737728277295936, 0.03857899550307486, 0.039792391023374125, 0.04101744138041482,
+    0.042254122413316234, 0.04350241356888818, 0.04476229773294328, 0.04603376107617517, 0.04731679291318155,
+    0.0486113855733795, 0.04991753428270637, 0.05123523705512628, 0.05256449459307169, 0.05390531019604609,
+    0.05525768967669704, 0.05662164128374288, 0.05799717563120066, 0.059384305633420266, 0.06078304644547963,
+    0.062193415408540995, 0.06361543199980733, 0.06504911778675375, 0.06649449638533977, 0.0679515934219366,
+    0.06942043649872875, 0.07090105516237183, 0.07239348087570874, 0.07389774699236475, 0.07541388873405841,
+    0.0769419431704805, 0.07848194920160642, 0.0800339475423199, 0.08159798070923742, 0.08317409300963238,
+    0.08476233053236812, 0.08636274114075691, 0.08797537446727022, 0.08960028191003286, 0.09123751663104016,
+    0.09288713355604354, 0.09454918937605586, 0.0962237425504328, 0.0979108533114922, 0.09961058367063713,
+    0.10132299742595363, 0.10304816017125772, 0.10478613930657017, 0.10653700405000166, 0.1083008254510338,
+    0.11007767640518538, 0.1118676316700563, 0.11367076788274431, 0.11548716357863353, 0.11731689921155557,
+    0.11916005717532768, 0.12101672182667483, 0.12288697950954514, 0.12477091858083096, 0.12666862943751067,
+    0.12858020454522817, 0.13050573846833077, 0.13244532790138752, 0.13439907170221363, 0.13636707092642886,
+    0.1383494288635802, 0.14034625107486245, 0.1423576454324722, 0.14438372216063478, 0.14642459387834494,
+    0.1484803756438668, 0.1505511850010399, 0.15263714202744286, 0.15473836938446808, 0.15685499236936523,
+    0.1589871389693142, 0.16113493991759203, 0.16329852875190182, 0.165478041874936, 0.1676736186172502,
+    0.16988540130252766, 0.17211353531532006, 0.1743581691713535, 0.17661945459049488, 0.1788975465724783,
+    0.1811926034754963, 0.18350478709776746, 0.1858342627621971, 0.18818119940425432, 0.1905457696631954,
+    0.19292814997677135, 0.19532852067956322, 0.19774706610509887, 0.20018397469191127, 0.20263943909370902,
+    0.2051136562938377, 0.20760682772422204, 0.21011915938898826, 0.21265086199297828, 0.21520215107537868,
+    0.21777324714870053, 0.2203643758433595, 0.2229757680581202, 0.22560766011668407, 0.2282602939307167,
+    0.2309339171696274, 0.23362878343743335, 0.23634515245705964, 0.23908329026244918, 0.24184346939887721,
+    0.2446259691318921, 0.24743107566532763, 0.2502590823688623, 0.25311029001562946, 0.2559850070304154,
+    0.25888354974901623, 0.261806242689363, 0.2647534188350622, 0.2677254199320448, 0.27072259679906,
+    0.27374530965280297, 0.27679392844851736, 0.2798688332369729, 0.28297041453878075, 0.2860990737370768,
+    0.28925522348967775, 0.2924392881618926, 0.2956517042812612, 0.2988929210155818, 0.3021634006756935,
+    0.30546361924459026, 0.3087940669345602, 0.31215524877417955, 0.31554768522712895, 0.31897191284495724,
+    0.32242848495608917, 0.3259179723935562, 0.3294409642641363, 0.332998068761809, 0.3365899140286776,
+    0.34021714906678, 0.3438804447045024, 0.347580494621637, 0.35131801643748334, 0.35509375286678746,
+    0.3589084729487498, 0.3627629733548178, 0.36665807978151416, 0.370594648435146, 0.37457356761590216,
+    0.3785957594095808, 0.38266218149600983, 0.38677382908413765, 0.3909317369847971, 0.39513698183329016,
+    0.3993906844752311, 0.4036940125305303, 0.4080481831520324, 0.4124544659971612, 0.4169141864330029,
+    0.4214287289976166, 0.42599954114303434, 0.43062813728845883, 0.4353161032156366, 0.4400651008423539,
+    0.4448768734145485, 0.449753251162755, 0.4546961574746155, 0.4597076156421377, 0.4647897562504262, 0.46994482528396,
+    0.4751751930373774, 0.4804833639304542, 0.4858719873418849, 0.49134386959403253, 0.49690198724154955,
+    0.5025495018413477, 0.5082897764106429, 0.5141263938147486, 0.5200631773682336, 0.5261042139836197,
+    0.5322538802630433, 0.5385168720028619, 0.5448982376724396, 0.5514034165406413, 0.5580382822625874,
+    0.5648091929124002, 0.5717230486648258, 0.578787358602845, 0.586010318477268, 0.5934009016917334,
+    0.6009689663652322, 0.608725382079622, 0.6166821809152077, 0.624852738703666, 0.6332519942143661,
+    0.6418967164272661, 0.6508058334145711, 0.6600008410789997, 0.6695063167319247, 0.6793505722647654,
+    0.689566496117078, 0.7001926550827882, 0.711274760805076, 0.722867659593572, 0.7350380924314235, 0.7478686219851951,
+    0.7614633888498963, 0.7759568520401156, 0.7915276369724956, 0.8084216515230084, 0.8269932966430503,
+    0.8477855006239896, 0.8717043323812036, 0.9004699299257465, 0.9381436808621747, 1.0};
+
+_STD_END
+
+#pragma pop_macro("new")
+_STL_RESTORE_CLANG_WARNINGS
+#pragma warning(pop)
+#pragma pack(pop)
+
+#endif // _STL_COMPILER_PREPROCESSOR
+#endif // __MSVC_ZIGGURAT_TABLES_HPP
@@ -205,6 +205,19 @@ enum class __std_access_rights : unsigned long {
     // #define FILE_GENERIC_WRITE    (STANDARD_RIGHTS_WRITE | FILE_WRITE_DATA | FILE_WRITE_ATTRIBUTES
     //                                   | FILE_WRITE_EA | FILE_APPEND_DATA | SYNCHRONIZE)
     _File_generic_write = 0x00120116,
+
+    // #define READ_CONTROL          (0x00020000L)
+    // #define STANDARD_RIGHTS_READ  (READ_CONTROL)
+    // #define FILE_READ_DATA        (0x0001)
+    // #define FILE_READ_ATTRIBUTES  (0x0080)
+    // #define FILE_READ_EA          (0x0008)
+    // #define SYNCHRONIZE           (0x00100000L)
+    // #define FILE_GENERIC_READ     (STANDARD_RIGHTS_READ | FILE_READ_DATA | FILE_READ_ATTRIBUTES
+    //                                   | FILE_READ_EA | SYNCHRONIZE)
+    _File_generic_read = 0x00120089,
+
+    // FILE_GENERIC_WRITE without FILE_WRITE_DATA, so that every write goes to the end of the file
+    _File_generic_append = 0x00120114,
 };
 } // extern "C"
 
@@ -217,6 +230,7 @@ enum class __std_fs_file_flags : unsigned long {
     _None               = 0,
     _Backup_semantics   = 0x02000000, // #define FILE_FLAG_BACKUP_SEMANTICS      0x02000000
     _Open_reparse_point = 0x00200000, // #define FILE_FLAG_OPEN_REPARSE_POINT    0x00200000
+    _Sequential_scan    = 0x08000000, // #define FILE_FLAG_SEQUENTIAL_SCAN       0x08000000
 };
 } // extern "C"
 
@@ -227,6 +241,19 @@ _END_EXTERN_CXX_WORKAROUND
 extern "C" {
 enum class __std_fs_file_handle : intptr_t { _Invalid = -1 };
 
+enum class __std_fs_file_disposition : unsigned long {
+    _Create_new    = 1, // #define CREATE_NEW          1
+    _Create_always = 2, // #define CREATE_ALWAYS       2
+    _Open_existing = 3, // #define OPEN_EXISTING       3
+    _Open_always   = 4, // #define OPEN_ALWAYS         4
+};
+
+enum class __std_fs_seek_origin : unsigned long {
+    _Begin   = 0, // #define FILE_BEGIN           0
+    _Current = 1, // #define FILE_CURRENT         1
+    _End     = 2, // #define FILE_END             2
+};
+
 enum class __std_code_page : unsigned int { _Acp = 0, _Utf8 = 65001 };
 
 struct __std_fs_convert_result {
@@ -258,6 +285,28 @@ _NODISCARD __std_win_error __stdcall __std_fs_open_handle(_Out_ __std_fs_file_ha
 
 void __stdcall __std_fs_close_handle(__std_fs_file_handle _Handle) noexcept;
 
+_NODISCARD __std_win_error __stdcall __std_fs_create_handle(_Out_ __std_fs_file_handle* _Handle,
+    _In_z_ const wchar_t* _File_name, _In_ __std_access_rights _Desired_access,
+    _In_ __std_fs_file_disposition _Disposition, _In_ __std_fs_file_flags _Flags) noexcept;
+
+_NODISCARD __std_win_error __stdcall __std_fs_read_handle(_In_ __std_fs_file_handle _Handle,
+    _Out_writes_bytes_to_(_Size, *_Transferred) void* _Buffer, _In_ size_t _Size,
+    _Out_ size_t* _Transferred) noexcept;
+
+_NODISCARD __std_win_error __stdcall __std_fs_write_handle(_In_ __std_fs_file_handle _Handle,
+    _In_reads_bytes_(_Size) const void* _Buffer, _In_ size_t _Size, _Out_ size_t* _Transferred) noexcept;
+
+_NODISCARD __std_win_error __stdcall __std_fs_seek_handle(_In_ __std_fs_file_handle _Handle, _In_ long long _Offset,
+    _In_ __std_fs_seek_origin _Origin, _Out_ long long* _New_position) noexcept;
+
+_NODISCARD __std_win_error __stdcall __std_fs_create_read_only_mapping(
+    _Out_ __std_fs_file_handle* _Mapping, _In_ __std_fs_file_handle _File) noexcept;
+
+_NODISCARD __std_win_error __stdcall __std_fs_map_read_only_view(_Out_ const void** _View,
+    _In_ __std_fs_file_handle _Mapping, _In_ unsigned long long _Offset, _In_ size_t _Size) noexcept;
+
+void __stdcall __std_fs_unmap_view(_In_ const void* _View) noexcept;
+
 _NODISCARD _Success_(return == __std_win_error::_Success) __std_win_error
     __stdcall __std_fs_get_file_attributes_by_handle(
         _In_ __std_fs_file_handle _Handle, _Out_ unsigned long* _File_attributes) noexcept;
@@ -356,6 +356,9 @@ struct _Has_no_alloc_destroy<pmr::polymorphic_allocator<_Ty>, _Ptr, void> : true
     // default implementation in allocator_traits so we can optimize it away.
 };
 
+template <class _Ty>
+constexpr bool _Is_trivially_relocatable_v<pmr::polymorphic_allocator<_Ty>> = true;
+
 #endif // _HAS_CXX17
 
 _STD_END
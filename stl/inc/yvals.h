@@ -289,6 +289,19 @@ extern "C" __declspec(noreturn) void __fastfail(unsigned int); // declared by <i
 #define _MSVC_STL_UINTPTR_TOMBSTONE_VALUE uintptr_t{19937}
 #endif
 
+// Define as 1 to let std::allocator extend blocks in place with the CRT's _expand() when containers grow.
+// This requires that the global ::operator new and ::operator delete are not replaced.
+#ifndef _MSVC_STL_ALLOCATOR_EXPAND_IN_PLACE
+#define _MSVC_STL_ALLOCATOR_EXPAND_IN_PLACE 0
+#endif
+
+// Define as a power of 2 from 16 to 65536 to give each std::deque block at least that many bytes, instead of the
+// original layout's 16 bytes (which holds a single element when it's larger than 8 bytes). This changes the
+// representation of every std::deque, so all translation units that share them must agree; <deque> detects mismatches.
+#ifndef _MSVC_STL_DEQUE_BLOCK_BYTES
+#define _MSVC_STL_DEQUE_BLOCK_BYTES 0 // 0 selects the original layout
+#endif
+
 #include <use_ansi.h>
 
 #ifdef _STATIC_CPPLIB
@@ -407,6 +407,12 @@
 // P3235R3 std::print More Types Faster With Less Memory
 //     (partial implementation; see GH-4924)
 
+// _HAS_CXX23 also directly controls these C++26 features (TRANSITION, _HAS_CXX26):
+// P0493R5 Atomic Minimum/Maximum
+// P1068R11 Vector API For Random Number Generation
+// P2530R3 Hazard Pointers For C++26
+// P2545R4 Read-Copy Update (RCU)
+
 // _HAS_CXX23 and _SILENCE_ALL_CXX23_DEPRECATION_WARNINGS control:
 // P1413R3 Deprecate aligned_storage And aligned_union
 // P2614R2 Deprecating float_denorm_style, numeric_limits::has_denorm, numeric_limits::has_denorm_loss
@@ -1068,6 +1074,13 @@ _EMIT_STL_ERROR(STL1004, "C++98 unexpected() is incompatible with C++23 unexpect
 #endif // ^^^ floating-point exceptions disabled (default) ^^^
 #endif // !defined(_STD_VECTORIZE_WITH_FLOAT_CONTROL)
 
+// Define as 1 to hash strings, string_views, filesystem::paths, and other byte representations a word at a time
+// (XXH64 on 64-bit targets, XXH32 on 32-bit targets) instead of a byte at a time with FNV-1a. This changes the hash
+// values, so all translation units that share hashed containers must agree; <type_traits> detects mismatches.
+#ifndef _MSVC_STL_WORDWISE_HASH
+#define _MSVC_STL_WORDWISE_HASH 0 // 0 selects FNV-1a
+#endif // !defined(_MSVC_STL_WORDWISE_HASH)
+
 // P0174R2 Deprecating Vestigial Library Parts
 // P0521R0 Deprecating shared_ptr::unique()
 // Other C++17 deprecation warnings
@@ -1782,6 +1795,7 @@ _EMIT_STL_ERROR(STL1004, "C++98 unexpected() is incompatible with C++23 unexpect
 #define __cpp_lib_adaptor_iterator_pair_constructor 202106L
 #define __cpp_lib_allocate_at_least                 202302L
 #define __cpp_lib_associative_heterogeneous_erasure 202110L
+#define __cpp_lib_atomic_min_max                    202403L
 #define __cpp_lib_bind_back                         202202L
 #define __cpp_lib_byteswap                          202110L
 #define __cpp_lib_constexpr_bitset                  202207L
@@ -1795,6 +1809,7 @@ _EMIT_STL_ERROR(STL1004, "C++98 unexpected() is incompatible with C++23 unexpect
 #define __cpp_lib_freestanding_expected             202311L
 #define __cpp_lib_freestanding_mdspan               202311L
 #define __cpp_lib_generator                         202207L
+#define __cpp_lib_hazard_pointer                    202306L
 #define __cpp_lib_invoke_r                          202106L
 #define __cpp_lib_ios_noreplace                     202207L
 #define __cpp_lib_is_scoped_enum                    202011L
@@ -1811,6 +1826,7 @@ _EMIT_STL_ERROR(STL1004, "C++98 unexpected() is incompatible with C++23 unexpect
 #define __cpp_lib_ranges_enumerate                  202302L
 #define __cpp_lib_ranges_find_last                  202207L
 #define __cpp_lib_ranges_fold                       202207L
+#define __cpp_lib_ranges_generate_random            202403L
 #define __cpp_lib_ranges_iota                       202202L
 #define __cpp_lib_ranges_join_with                  202202L
 #define __cpp_lib_ranges_repeat                     202207L
@@ -1819,6 +1835,7 @@ _EMIT_STL_ERROR(STL1004, "C++98 unexpected() is incompatible with C++23 unexpect
 #define __cpp_lib_ranges_stride                     202207L
 #define __cpp_lib_ranges_to_container               202202L
 #define __cpp_lib_ranges_zip                        202110L
+#define __cpp_lib_rcu                               202306L
 #define __cpp_lib_spanstream                        202106L
 #define __cpp_lib_stacktrace                        202011L
 #define __cpp_lib_stdatomic_h                       202011L
@@ -71,6 +71,7 @@ export module std;
 #include <future>
 #if _HAS_CXX23
 #include <generator>
+#include <hazard_pointer>
 #endif // _HAS_CXX23
 #include <initializer_list>
 #include <iomanip>
@@ -102,6 +103,9 @@ export module std;
 #include <random>
 #include <ranges>
 #include <ratio>
+#if _HAS_CXX23
+#include <rcu>
+#endif // _HAS_CXX23
 #include <regex>
 #include <scoped_allocator>
 #include <semaphore>
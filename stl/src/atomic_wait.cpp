@@ -4,6 +4,7 @@
 // implement atomic wait / notify_one / notify_all
 
 #include <atomic>
+#include <climits>
 #include <cstdint>
 #include <cstdlib>
 #include <new>
@@ -16,9 +17,21 @@
 namespace {
     constexpr unsigned long long _Atomic_wait_no_deadline = 0xFFFF'FFFF'FFFF'FFFF;
 
-    constexpr size_t _Wait_table_size_power = 8;
-    constexpr size_t _Wait_table_size       = 1 << _Wait_table_size_power;
-    constexpr size_t _Wait_table_index_mask = _Wait_table_size - 1;
+    // The wait table is sized once, from the number of hardware threads, so that unrelated waiters rarely share an
+    // entry; the smallest size is kept in .bss as a fallback for when the larger table can't be allocated.
+    constexpr size_t _Wait_table_min_size_power  = 8;
+    constexpr size_t _Wait_table_max_size_power  = 16;
+    constexpr size_t _Wait_table_entries_per_cpu = 64;
+
+    // Before parking, waiters spin for a bounded number of pause instructions. The budget is kept per wait table entry
+    // and adapted from how recent waits on that entry ended.
+    constexpr unsigned long _Spin_limit_min       = 16;
+    constexpr unsigned long _Spin_limit_default   = 256;
+    constexpr unsigned long _Spin_limit_max       = 2048;
+    constexpr unsigned long _Max_pauses_per_check = 64;
+
+    // A park that ends sooner than this was likely cheaper to cover by spinning for longer.
+    constexpr long long _Short_park_microseconds = 50;
 
     struct _Wait_context {
         const void* _Storage; // Pointer to wait on
@@ -28,8 +41,8 @@ namespace {
     };
 
     struct [[nodiscard]] _Guarded_wait_context : _Wait_context {
-        _Guarded_wait_context(const void* _Storage_, _Wait_context* const _Head) noexcept
-            : _Wait_context{_Storage_, _Head, _Head->_Prev, CONDITION_VARIABLE_INIT} {
+        _Guarded_wait_context(const void* _Storage_, _Wait_context* const _Insert_before) noexcept
+            : _Wait_context{_Storage_, _Insert_before, _Insert_before->_Prev, CONDITION_VARIABLE_INIT} {
             _Prev->_Next = this;
             _Next->_Prev = this;
         }
@@ -67,21 +80,232 @@ namespace {
     struct alignas(_STD hardware_destructive_interference_size) _Wait_table_entry {
         SRWLOCK _Lock = SRWLOCK_INIT;
         // Initialize to all zeros, self-link lazily to optimize for space.
-        // Since _Wait_table_entry is initialized to all zero bytes,
-        // _Atomic_wait_table_entry::wait_table will also be all zero bytes.
-        // It can thus can be stored in the .bss section, and not in the actual binary.
+        // Since _Wait_table_entry is initialized to all zero bytes, the fallback table will also be all zero bytes.
+        // It can thus be stored in the .bss section, and not in the actual binary; likewise, the larger table
+        // needs no construction beyond the zeroed pages that VirtualAlloc returns.
         _Wait_context _Wait_list_head = {nullptr, nullptr, nullptr, CONDITION_VARIABLE_INIT};
 
+        _STD atomic<unsigned long> _Spin_limit{}; // zero until first tuned, meaning _Spin_limit_default
+        _STD atomic<unsigned long> _Waiters{}; // number of threads parked on a _Wait_context in this entry's list
+
         constexpr _Wait_table_entry() noexcept = default;
     };
 #pragma warning(pop)
 
+    class [[nodiscard]] _Waiter_count_guard {
+    public:
+        explicit _Waiter_count_guard(_STD atomic<unsigned long>& _Waiters_) noexcept : _Waiters(&_Waiters_) {
+            _Waiters->fetch_add(1, _STD memory_order_relaxed);
+            _STD atomic_thread_fence(_STD memory_order_seq_cst); // see _May_have_parked_waiters
+        }
+
+        ~_Waiter_count_guard() {
+            _Waiters->fetch_sub(1, _STD memory_order_relaxed);
+        }
+
+        _Waiter_count_guard(const _Waiter_count_guard&)            = delete;
+        _Waiter_count_guard& operator=(const _Waiter_count_guard&) = delete;
+
+    private:
+        _STD atomic<unsigned long>* _Waiters;
+    };
+
+    [[nodiscard]] unsigned long _Processor_count() noexcept {
+        static _STD atomic<unsigned long> _Count{}; // zero until first queried
+        auto _Result = _Count.load(_STD memory_order_relaxed);
+        if (_Result == 0) {
+            _Result = GetActiveProcessorCount(ALL_PROCESSOR_GROUPS);
+            if (_Result == 0) {
+                _Result = 1;
+            }
+
+            _Count.store(_Result, _STD memory_order_relaxed);
+        }
+
+        return _Result;
+    }
+
+    [[nodiscard]] bool _Is_uniprocessor() noexcept {
+        return _Processor_count() == 1;
+    }
+
+    struct _Wait_table {
+        _Wait_table_entry* _Entries;
+        unsigned int _Shift; // number of low bits dropped from the hashed address
+    };
+
+    [[nodiscard]] _Wait_table _Make_wait_table() noexcept {
+        constexpr unsigned int _Address_bits = CHAR_BIT * sizeof(_STD uintptr_t);
+        static _Wait_table_entry _Fallback_entries[size_t{1} << _Wait_table_min_size_power];
+
+        const size_t _Wanted = size_t{_Processor_count()} * _Wait_table_entries_per_cpu;
+        size_t _Size_power   = _Wait_table_min_size_power;
+        while (_Size_power < _Wait_table_max_size_power && (size_t{1} << _Size_power) < _Wanted) {
+            ++_Size_power;
+        }
+
+        if (_Size_power != _Wait_table_min_size_power) {
+            // Never freed, like the static table: waits and notifies may happen until the process ends.
+            const size_t _Size  = size_t{1} << _Size_power;
+            const size_t _Bytes = _Size * sizeof(_Wait_table_entry);
+            // The pages are zero-filled on first touch, so entries that are never used never get physical memory.
+            const auto _Raw = VirtualAlloc(nullptr, _Bytes, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+            if (_Raw) {
+                return {static_cast<_Wait_table_entry*>(_Raw), static_cast<unsigned int>(_Address_bits - _Size_power)};
+            }
+        }
+
+        return {_Fallback_entries, static_cast<unsigned int>(_Address_bits - _Wait_table_min_size_power)};
+    }
+
+    [[nodiscard]] const _Wait_table& _Get_wait_table() noexcept {
+        // The STL is built with /Zc:threadSafeInit-, so the table is published through INIT_ONCE instead.
+        // Once it has been, waits and notifies only pay for the acquire load of _Published.
+        static _Wait_table _Table{};
+        static _STD atomic<const _Wait_table*> _Published{};
+        static INIT_ONCE _Table_once = INIT_ONCE_STATIC_INIT;
+        if (const auto _Ptr = _Published.load(_STD memory_order_acquire)) {
+            return *_Ptr;
+        }
+
+        InitOnceExecuteOnce(
+            &_Table_once,
+            [](PINIT_ONCE, PVOID, PVOID*) noexcept -> BOOL {
+                _Table = _Make_wait_table();
+                _Published.store(&_Table, _STD memory_order_release);
+                return TRUE;
+            },
+            nullptr, nullptr);
+        return _Table;
+    }
+
     [[nodiscard]] _Wait_table_entry& _Atomic_wait_table_entry(const void* const _Storage) noexcept {
-        static _Wait_table_entry wait_table[_Wait_table_size];
-        auto index = reinterpret_cast<_STD uintptr_t>(_Storage);
-        index ^= index >> (_Wait_table_size_power * 2);
-        index ^= index >> _Wait_table_size_power;
-        return wait_table[index & _Wait_table_index_mask];
+        const auto& _Table = _Get_wait_table();
+#ifdef _WIN64
+        constexpr _STD uintptr_t _Golden_ratio = 0x9E37'79B9'7F4A'7C15;
+#else // ^^^ 64-bit / 32-bit vvv
+        constexpr _STD uintptr_t _Golden_ratio = 0x9E37'79B9;
+#endif // ^^^ 32-bit ^^^
+        // Fibonacci hashing: the multiplication carries the low address bits, which vary the most between
+        // neighboring atomics, into the high bits that select the entry.
+        return _Table._Entries[(reinterpret_cast<_STD uintptr_t>(_Storage) * _Golden_ratio) >> _Table._Shift];
+    }
+
+    [[nodiscard]] _Wait_context* _Insertion_point(const void* const _Storage, _Wait_context* const _Head) noexcept {
+        // Keeps contexts waiting on the same address adjacent and in arrival order, so notify_all can stop after
+        // the first run of matches and notify_one still wakes the longest waiting thread.
+        _Wait_context* _Context = _Head->_Next;
+        while (_Context != _Head && _Context->_Storage != _Storage) {
+            _Context = _Context->_Next;
+        }
+
+        while (_Context != _Head && _Context->_Storage == _Storage) {
+            _Context = _Context->_Next;
+        }
+
+        return _Context;
+    }
+
+    [[nodiscard]] long long _Query_ticks() noexcept {
+        LARGE_INTEGER _Now;
+        QueryPerformanceCounter(&_Now);
+        return _Now.QuadPart;
+    }
+
+    [[nodiscard]] long long _Short_park_ticks() noexcept {
+        static _STD atomic<long long> _Ticks{}; // zero until first queried
+        auto _Result = _Ticks.load(_STD memory_order_relaxed);
+        if (_Result == 0) {
+            LARGE_INTEGER _Frequency;
+            QueryPerformanceFrequency(&_Frequency);
+            _Result = _Frequency.QuadPart / (1'000'000 / _Short_park_microseconds);
+            if (_Result == 0) {
+                _Result = 1;
+            }
+
+            _Ticks.store(_Result, _STD memory_order_relaxed);
+        }
+
+        return _Result;
+    }
+
+    [[nodiscard]] unsigned long _Current_spin_limit(const _Wait_table_entry& _Entry) noexcept {
+        const auto _Limit = _Entry._Spin_limit.load(_STD memory_order_relaxed);
+        return _Limit == 0 ? _Spin_limit_default : _Limit;
+    }
+
+    template <class _Predicate>
+    [[nodiscard]] bool _Spin_until(_Wait_table_entry& _Entry, _Predicate _Pred) noexcept {
+        // Polls _Pred with exponentially growing pauses in between until it holds or the entry's budget runs out.
+        if (_Is_uniprocessor()) {
+            return false; // the thread that would change the value can't run while we spin
+        }
+
+        const auto _Limit     = _Current_spin_limit(_Entry);
+        unsigned long _Spent  = 0;
+        unsigned long _Pauses = 1;
+        while (_Spent < _Limit) {
+            for (unsigned long _Idx = 0; _Idx != _Pauses; ++_Idx) {
+                YieldProcessor();
+            }
+
+            _Spent += _Pauses;
+            if (_Pred()) {
+                if (_Spent > _Limit / 2 && _Limit < _Spin_limit_max) {
+                    // barely made it; leave more room for the next waiter
+                    _Entry._Spin_limit.store(_Limit * 2, _STD memory_order_relaxed);
+                }
+
+                return true;
+            }
+
+            if (_Pauses < _Max_pauses_per_check) {
+                _Pauses *= 2;
+            }
+        }
+
+        return false;
+    }
+
+    void _Tune_after_park(_Wait_table_entry& _Entry, const long long _Park_start) noexcept {
+        // Only called for parks that ended with a wake, not a timeout.
+        const auto _Limit = _Current_spin_limit(_Entry);
+        if (_Query_ticks() - _Park_start < _Short_park_ticks()) {
+            if (_Limit < _Spin_limit_max) {
+                _Entry._Spin_limit.store(_Limit * 2, _STD memory_order_relaxed);
+            }
+        } else if (_Limit > _Spin_limit_min) {
+            _Entry._Spin_limit.store(_Limit / 2, _STD memory_order_relaxed);
+        }
+    }
+
+    [[nodiscard]] bool _Direct_equal(
+        const void* const _Storage, const void* const _Comparand, const size_t _Size) noexcept {
+        switch (_Size) {
+        case 1:
+            return __iso_volatile_load8(static_cast<const volatile char*>(_Storage))
+                == *static_cast<const char*>(_Comparand);
+        case 2:
+            return __iso_volatile_load16(static_cast<const volatile short*>(_Storage))
+                == *static_cast<const short*>(_Comparand);
+        case 4:
+            return __iso_volatile_load32(static_cast<const volatile int*>(_Storage))
+                == *static_cast<const int*>(_Comparand);
+        case 8:
+            return __iso_volatile_load64(static_cast<const volatile long long*>(_Storage))
+                == *static_cast<const long long*>(_Comparand);
+        default:
+            return true; // not reached; let WaitOnAddress diagnose the size
+        }
+    }
+
+    [[nodiscard]] bool _May_have_parked_waiters(const _Wait_table_entry& _Entry) noexcept {
+        // Only for the indirect functions: a notify can only wake contexts in this module's own table anyway, whereas
+        // WaitOnAddress waiters may have parked through another module's copy of these functions.
+        // Pairs with the fence in _Waiter_count_guard: either we observe the waiter's increment of _Waiters,
+        // or the waiter's final comparison observes the value stored before this notification.
+        _STD atomic_thread_fence(_STD memory_order_seq_cst);
+        return _Entry._Waiters.load(_STD memory_order_relaxed) != 0;
     }
 
     void _Assume_timeout() noexcept {
@@ -96,11 +320,20 @@ namespace {
 extern "C" {
 int __stdcall __std_atomic_wait_direct(const void* const _Storage, void* const _Comparand, const size_t _Size,
     const unsigned long _Remaining_timeout) noexcept {
+    auto& _Entry = _Atomic_wait_table_entry(_Storage);
+    if (_Remaining_timeout != 0
+        && _Spin_until(_Entry, [=] { return !_Direct_equal(_Storage, _Comparand, _Size); })) {
+        return TRUE;
+    }
+
+    const auto _Park_start = _Query_ticks();
     const auto _Result =
         WaitOnAddress(const_cast<volatile void*>(_Storage), const_cast<void*>(_Comparand), _Size, _Remaining_timeout);
 
     if (!_Result) {
         _Assume_timeout();
+    } else if (_Remaining_timeout == __std_atomic_wait_no_timeout) {
+        _Tune_after_park(_Entry, _Park_start);
     }
     return _Result;
 }
@@ -115,6 +348,10 @@ void __stdcall __std_atomic_notify_all_direct(const void* const _Storage) noexce
 
 void __stdcall __std_atomic_notify_one_indirect(const void* const _Storage) noexcept {
     auto& _Entry = _Atomic_wait_table_entry(_Storage);
+    if (!_May_have_parked_waiters(_Entry)) {
+        return;
+    }
+
     _SrwLock_guard _Guard(_Entry._Lock);
     _Wait_context* _Context = _Entry._Wait_list_head._Next;
 
@@ -133,6 +370,10 @@ void __stdcall __std_atomic_notify_one_indirect(const void* const _Storage) noex
 
 void __stdcall __std_atomic_notify_all_indirect(const void* const _Storage) noexcept {
     auto& _Entry = _Atomic_wait_table_entry(_Storage);
+    if (!_May_have_parked_waiters(_Entry)) {
+        return;
+    }
+
     _SrwLock_guard _Guard(_Entry._Lock);
     _Wait_context* _Context = _Entry._Wait_list_head._Next;
 
@@ -140,17 +381,24 @@ void __stdcall __std_atomic_notify_all_indirect(const void* const _Storage) noex
         return;
     }
 
-    for (; _Context != &_Entry._Wait_list_head; _Context = _Context->_Next) {
-        if (_Context->_Storage == _Storage) {
-            // Can't move wake outside SRWLOCKed section: SRWLOCK also protects the _Context itself
-            WakeAllConditionVariable(&_Context->_Condition);
-        }
+    while (_Context != &_Entry._Wait_list_head && _Context->_Storage != _Storage) {
+        _Context = _Context->_Next;
+    }
+
+    // contexts for the same address are adjacent, see _Insertion_point
+    for (; _Context != &_Entry._Wait_list_head && _Context->_Storage == _Storage; _Context = _Context->_Next) {
+        // Can't move wake outside SRWLOCKed section: SRWLOCK also protects the _Context itself
+        WakeAllConditionVariable(&_Context->_Condition);
     }
 }
 
 int __stdcall __std_atomic_wait_indirect(const void* _Storage, void* _Comparand, size_t _Size, void* _Param,
     _Atomic_wait_indirect_equal_callback_t _Are_equal, unsigned long _Remaining_timeout) noexcept {
     auto& _Entry = _Atomic_wait_table_entry(_Storage);
+    if (_Remaining_timeout != 0
+        && _Spin_until(_Entry, [=] { return !_Are_equal(_Storage, _Comparand, _Size, _Param); })) {
+        return TRUE;
+    }
 
     _SrwLock_guard _Guard(_Entry._Lock);
 
@@ -159,9 +407,15 @@ int __stdcall __std_atomic_wait_indirect(const void* _Storage, void* _Comparand,
         _Entry._Wait_list_head._Prev = &_Entry._Wait_list_head;
     }
 
-    _Guarded_wait_context _Context{_Storage, &_Entry._Wait_list_head};
+    _Guarded_wait_context _Context{_Storage, _Insertion_point(_Storage, &_Entry._Wait_list_head)};
+    _Waiter_count_guard _Counted(_Entry._Waiters);
+    const auto _Park_start = _Query_ticks();
+    bool _Slept            = false;
     for (;;) {
         if (!_Are_equal(_Storage, _Comparand, _Size, _Param)) { // note: under lock to prevent lost wakes
+            if (_Slept) {
+                _Tune_after_park(_Entry, _Park_start);
+            }
             return TRUE;
         }
 
@@ -170,6 +424,7 @@ int __stdcall __std_atomic_wait_indirect(const void* _Storage, void* _Comparand,
             return FALSE;
         }
 
+        _Slept = true;
         if (_Remaining_timeout != __std_atomic_wait_no_timeout) {
             // spurious wake to recheck the clock
             return TRUE;
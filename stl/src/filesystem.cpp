@@ -20,6 +20,9 @@
                                 // '__std_win_error' is not explicitly handled by a case label
 
 static_assert(__std_code_page::_Utf8 == __std_code_page{CP_UTF8});
+static_assert(__std_fs_file_disposition::_Create_new == __std_fs_file_disposition{CREATE_NEW});
+static_assert(__std_fs_file_disposition::_Open_always == __std_fs_file_disposition{OPEN_ALWAYS});
+static_assert(__std_fs_seek_origin::_End == __std_fs_seek_origin{FILE_END});
 
 namespace {
 
@@ -150,6 +153,10 @@ namespace {
     [[nodiscard]] unsigned long long _Merge_to_ull(DWORD _High, DWORD _Low) noexcept {
         return (static_cast<unsigned long long>(_High) << 32) | static_cast<unsigned long long>(_Low);
     }
+
+    // ReadFile and WriteFile take 32-bit sizes; larger transfers are split into 1 GiB pieces, which keeps each
+    // piece aligned for unbuffered handles.
+    constexpr size_t _Max_transfer_size = 0x4000'0000;
 } // unnamed namespace
 
 extern "C" {
@@ -176,6 +183,112 @@ void __stdcall __std_fs_close_handle(const __std_fs_file_handle _Handle) noexcep
     }
 }
 
+[[nodiscard]] __std_win_error __stdcall __std_fs_create_handle(_Out_ __std_fs_file_handle* const _Handle,
+    _In_z_ const wchar_t* const _File_name, _In_ const __std_access_rights _Desired_access,
+    _In_ const __std_fs_file_disposition _Disposition, _In_ const __std_fs_file_flags _Flags) noexcept {
+    // calls CreateFile2 or CreateFileW, sharing the file for reading and writing like _fsopen
+    const HANDLE _Result = __vcp_CreateFile(_File_name, static_cast<unsigned long>(_Desired_access),
+        FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, static_cast<unsigned long>(_Disposition),
+        FILE_ATTRIBUTE_NORMAL | static_cast<unsigned long>(_Flags), nullptr);
+    *_Handle             = static_cast<__std_fs_file_handle>(reinterpret_cast<intptr_t>(_Result));
+    return _Translate_CreateFile_last_error(_Result);
+}
+
+[[nodiscard]] __std_win_error __stdcall __std_fs_read_handle(_In_ const __std_fs_file_handle _Handle,
+    _Out_writes_bytes_to_(_Size, *_Transferred) void* const _Buffer, _In_ const size_t _Size,
+    _Out_ size_t* const _Transferred) noexcept {
+    // calls ReadFile once; a short read is not an error, and end of file reads nothing
+    const auto _Chunk   = static_cast<unsigned long>(_Size < _Max_transfer_size ? _Size : _Max_transfer_size);
+    unsigned long _Read = 0;
+    const BOOL _Ok      = ReadFile(reinterpret_cast<HANDLE>(_Handle), _Buffer, _Chunk, &_Read, nullptr);
+    *_Transferred       = _Read;
+    if (_Ok) {
+        return __std_win_error::_Success;
+    }
+
+    const unsigned long _Last_error = GetLastError();
+    if (_Last_error == ERROR_HANDLE_EOF || _Last_error == ERROR_BROKEN_PIPE) {
+        return __std_win_error::_Success; // end of file, or the writing end of a pipe was closed
+    }
+
+    return __std_win_error{_Last_error};
+}
+
+[[nodiscard]] __std_win_error __stdcall __std_fs_write_handle(_In_ const __std_fs_file_handle _Handle,
+    _In_reads_bytes_(_Size) const void* const _Buffer, _In_ const size_t _Size,
+    _Out_ size_t* const _Transferred) noexcept {
+    // calls WriteFile until everything is written
+    auto _Next    = static_cast<const unsigned char*>(_Buffer);
+    auto _Left    = _Size;
+    *_Transferred = 0;
+    while (_Left != 0) {
+        const auto _Chunk      = static_cast<unsigned long>(_Left < _Max_transfer_size ? _Left : _Max_transfer_size);
+        unsigned long _Written = 0;
+        if (!WriteFile(reinterpret_cast<HANDLE>(_Handle), _Next, _Chunk, &_Written, nullptr)) {
+            return __std_win_error{GetLastError()};
+        }
+
+        _Next += _Written;
+        _Left -= _Written;
+        *_Transferred += _Written;
+    }
+
+    return __std_win_error::_Success;
+}
+
+[[nodiscard]] __std_win_error __stdcall __std_fs_seek_handle(_In_ const __std_fs_file_handle _Handle,
+    _In_ const long long _Offset, _In_ const __std_fs_seek_origin _Origin,
+    _Out_ long long* const _New_position) noexcept { // calls SetFilePointerEx
+    LARGE_INTEGER _Distance;
+    _Distance.QuadPart = _Offset;
+    LARGE_INTEGER _Result;
+    if (SetFilePointerEx(
+            reinterpret_cast<HANDLE>(_Handle), _Distance, &_Result, static_cast<unsigned long>(_Origin))) {
+        *_New_position = _Result.QuadPart;
+        return __std_win_error::_Success;
+    }
+
+    *_New_position = -1;
+    return __std_win_error{GetLastError()};
+}
+
+[[nodiscard]] __std_win_error __stdcall __std_fs_create_read_only_mapping(
+    _Out_ __std_fs_file_handle* const _Mapping, _In_ const __std_fs_file_handle _File) noexcept {
+    // calls CreateFileMappingW or CreateFileMappingFromApp; empty files can't be mapped
+#ifdef _CRT_APP
+    const HANDLE _Result =
+        CreateFileMappingFromApp(reinterpret_cast<HANDLE>(_File), nullptr, PAGE_READONLY, 0, nullptr);
+#else // ^^^ defined(_CRT_APP) / !defined(_CRT_APP) vvv
+    const HANDLE _Result = CreateFileMappingW(reinterpret_cast<HANDLE>(_File), nullptr, PAGE_READONLY, 0, 0, nullptr);
+#endif // ^^^ !defined(_CRT_APP) ^^^
+    if (_Result) { // unlike CreateFile, failure is reported with null rather than INVALID_HANDLE_VALUE
+        *_Mapping = static_cast<__std_fs_file_handle>(reinterpret_cast<intptr_t>(_Result));
+        return __std_win_error::_Success;
+    }
+
+    *_Mapping = __std_fs_file_handle::_Invalid;
+    return __std_win_error{GetLastError()};
+}
+
+[[nodiscard]] __std_win_error __stdcall __std_fs_map_read_only_view(_Out_ const void** const _View,
+    _In_ const __std_fs_file_handle _Mapping, _In_ const unsigned long long _Offset,
+    _In_ const size_t _Size) noexcept {
+    // calls MapViewOfFile or MapViewOfFileFromApp; _Offset must be a multiple of the allocation granularity
+#ifdef _CRT_APP
+    *_View = MapViewOfFileFromApp(reinterpret_cast<HANDLE>(_Mapping), FILE_MAP_READ, _Offset, _Size);
+#else // ^^^ defined(_CRT_APP) / !defined(_CRT_APP) vvv
+    *_View = MapViewOfFile(reinterpret_cast<HANDLE>(_Mapping), FILE_MAP_READ, static_cast<DWORD>(_Offset >> 32),
+        static_cast<DWORD>(_Offset), _Size);
+#endif // ^^^ !defined(_CRT_APP) ^^^
+    return *_View ? __std_win_error::_Success : __std_win_error{GetLastError()};
+}
+
+void __stdcall __std_fs_unmap_view(_In_ const void* const _View) noexcept { // calls UnmapViewOfFile
+    if (_View && !UnmapViewOfFile(_View)) {
+        _CSTD abort();
+    }
+}
+
 [[nodiscard]] _Success_(return == __std_win_error::_Success) __std_win_error
     __stdcall __std_fs_get_file_attributes_by_handle(
         _In_ const __std_fs_file_handle _Handle, _Out_ unsigned long* const _File_attributes) noexcept {
@@ -0,0 +1,235 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// implement hazard pointer slots and deferred reclamation
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <hazard_pointer>
+#include <new>
+
+#include <Windows.h>
+
+namespace {
+    // Retired objects are reclaimed in batches: a scan runs once the number of queued objects reaches
+    // max(_Scan_threshold_min, _Scan_threshold_per_slot * <number of slots>), which keeps its cost, linear in the
+    // number of slots, amortized to a constant per retired object.
+    constexpr size_t _Scan_threshold_min      = 128;
+    constexpr size_t _Scan_threshold_per_slot = 2;
+
+    // Each thread keeps this many released slots for itself, so that make_hazard_pointer usually doesn't touch shared
+    // state at all.
+    constexpr size_t _Thread_cache_size = 8;
+
+    // Readers store into their slots often; keep each slot on its own cache line.
+    struct alignas(_STD hardware_destructive_interference_size) _Hazard_record {
+        _STD atomic<const void*> _Protected{nullptr}; // first member; see _Record_from_slot
+        _STD atomic<bool> _Active{true};
+        _Hazard_record* _Next = nullptr;
+    };
+
+    // Records are never freed, so the list can be traversed without synchronization beyond acquiring the head.
+    _STD atomic<_Hazard_record*> _Records{nullptr};
+    _STD atomic<size_t> _Record_count{0};
+
+    _STD atomic<__std_hazard_retired*> _Retired_head{nullptr};
+    _STD atomic<size_t> _Retired_count{0};
+
+    [[nodiscard]] _Hazard_record* _Record_from_slot(_STD atomic<const void*>* const _Slot) noexcept {
+        return reinterpret_cast<_Hazard_record*>(_Slot);
+    }
+
+    struct _Thread_cache {
+        _Hazard_record* _Records[_Thread_cache_size]{};
+        size_t _Size = 0;
+        bool _Scanning = false; // set while this thread reclaims, so that deleters calling retire() don't rescan
+        bool _Closed   = false; // set on thread exit, for hazard_pointers in thread_locals that are destroyed later
+
+        _Thread_cache() = default;
+
+        _Thread_cache(const _Thread_cache&)            = delete;
+        _Thread_cache& operator=(const _Thread_cache&) = delete;
+
+        ~_Thread_cache(); // defined below _Scan
+    };
+
+    thread_local _Thread_cache _Cache;
+
+    [[nodiscard]] _Hazard_record* _Claim_record() noexcept {
+        for (auto _Record = _Records.load(_STD memory_order_acquire); _Record; _Record = _Record->_Next) {
+            if (!_Record->_Active.load(_STD memory_order_relaxed)
+                && !_Record->_Active.exchange(true, _STD memory_order_acquire)) {
+                return _Record;
+            }
+        }
+
+        const auto _Record = new (_STD nothrow) _Hazard_record;
+        if (!_Record) {
+            return nullptr;
+        }
+
+        // counted before it's published, so that a scan never finds more records than it has room for
+        _Record_count.fetch_add(1, _STD memory_order_relaxed);
+        _Record->_Next = _Records.load(_STD memory_order_relaxed);
+        while (!_Records.compare_exchange_weak(_Record->_Next, _Record, _STD memory_order_release)) {
+        }
+
+        return _Record;
+    }
+
+    void _Push_retired(
+        __std_hazard_retired* const _First, __std_hazard_retired* const _Last, const size_t _Count) noexcept {
+        _Last->_Next = _Retired_head.load(_STD memory_order_relaxed);
+        while (!_Retired_head.compare_exchange_weak(_Last->_Next, _First, _STD memory_order_release)) {
+        }
+
+        _Retired_count.fetch_add(_Count, _STD memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool _Is_protected_linear(const void* const _Object) noexcept {
+        for (auto _Record = _Records.load(_STD memory_order_acquire); _Record; _Record = _Record->_Next) {
+            if (_Record->_Protected.load(_STD memory_order_acquire) == _Object) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void _Scan() noexcept {
+        auto _List = _Retired_head.exchange(nullptr, _STD memory_order_acquire);
+        if (!_List) {
+            return; // another thread took the batch
+        }
+
+        size_t _Taken = 0;
+        for (auto _Node = _List; _Node; _Node = _Node->_Next) {
+            ++_Taken;
+        }
+
+        _Retired_count.fetch_sub(_Taken, _STD memory_order_relaxed);
+
+        // The reclaimer's half of the asymmetric fence paired with hazard_pointer::reset_protection(): after this,
+        // every reader either has its hazard visible to the loads below, or will observe the stores that unlinked
+        // the retired objects when it validates its protection.
+        FlushProcessWriteBuffers();
+
+        // Snapshot the hazards into a sorted array so that each retired object is checked in logarithmic time. If
+        // the array can't be allocated, fall back to walking the records for each object. Records published after
+        // _First_record can't protect anything in _List, because readers validate against the source after storing.
+        const auto _First_record = _Records.load(_STD memory_order_acquire);
+        const size_t _Capacity   = _Record_count.load(_STD memory_order_relaxed);
+        const auto _Hazards      = static_cast<const void**>(_CSTD malloc(_Capacity * sizeof(const void*)));
+        size_t _Hazard_count     = 0;
+        if (_Hazards) {
+            for (auto _Record = _First_record; _Record; _Record = _Record->_Next) {
+                const auto _Protected = _Record->_Protected.load(_STD memory_order_acquire);
+                if (_Protected) {
+                    _Hazards[_Hazard_count++] = _Protected;
+                }
+            }
+
+            _STD sort(_Hazards, _Hazards + _Hazard_count);
+        }
+
+        __std_hazard_retired* _Kept_first = nullptr;
+        __std_hazard_retired* _Kept_last  = nullptr;
+        size_t _Kept_count                = 0;
+        while (_List) {
+            const auto _Node = _List;
+            _List            = _Node->_Next; // _Node may be destroyed below
+
+            const bool _Protected = _Hazards ? _STD binary_search(_Hazards, _Hazards + _Hazard_count, _Node->_Object)
+                                             : _Is_protected_linear(_Node->_Object);
+            if (_Protected) {
+                _Node->_Next = _Kept_first;
+                _Kept_first  = _Node;
+                if (!_Kept_last) {
+                    _Kept_last = _Node;
+                }
+
+                ++_Kept_count;
+            } else {
+                _Node->_Reclaim(_Node);
+            }
+        }
+
+        _CSTD free(_Hazards);
+
+        if (_Kept_first) {
+            _Push_retired(_Kept_first, _Kept_last, _Kept_count);
+        }
+    }
+
+    _Thread_cache::~_Thread_cache() {
+        for (size_t _Idx = 0; _Idx != _Size; ++_Idx) {
+            _Records[_Idx]->_Active.store(false, _STD memory_order_release);
+        }
+
+        _Size   = 0;
+        _Closed = true;
+
+        // Programs that retire fewer objects than the scan threshold would otherwise never reclaim them, so a thread
+        // that exits reclaims whatever is queued and unprotected. Deleters can retire more objects, so this repeats
+        // while it makes progress; objects that stay protected are left for a later scan.
+        _Scanning = true;
+        for (size_t _Before = _Retired_count.load(_STD memory_order_relaxed); _Before != 0;) {
+            _Scan();
+            const size_t _After = _Retired_count.load(_STD memory_order_relaxed);
+            if (_After >= _Before) {
+                break;
+            }
+
+            _Before = _After;
+        }
+
+        _Scanning = false;
+    }
+} // unnamed namespace
+
+extern "C" {
+
+[[nodiscard]] _STD atomic<const void*>* __stdcall __std_hazard_pointer_acquire() noexcept {
+    auto& _Local = _Cache;
+    if (_Local._Size != 0) {
+        return &_Local._Records[--_Local._Size]->_Protected;
+    }
+
+    const auto _Record = _Claim_record();
+    return _Record ? &_Record->_Protected : nullptr;
+}
+
+void __stdcall __std_hazard_pointer_release(_STD atomic<const void*>* const _Slot) noexcept {
+    _Slot->store(nullptr, _STD memory_order_release);
+
+    const auto _Record = _Record_from_slot(_Slot);
+    auto& _Local       = _Cache;
+    if (!_Local._Closed && _Local._Size != _Thread_cache_size) {
+        _Local._Records[_Local._Size++] = _Record; // stays active, owned by this thread
+    } else {
+        _Record->_Active.store(false, _STD memory_order_release);
+    }
+}
+
+void __stdcall __std_hazard_pointer_retire(__std_hazard_retired* const _Retired) noexcept {
+    auto& _Local = _Cache; // odr-used here so that this thread's cache, which reclaims at thread exit, is constructed
+    _Push_retired(_Retired, _Retired, 1);
+
+    const size_t _Threshold =
+        (_STD max) (_Scan_threshold_min, _Scan_threshold_per_slot * _Record_count.load(_STD memory_order_relaxed));
+    if (!_Local._Closed && _Retired_count.load(_STD memory_order_relaxed) < _Threshold) {
+        return; // objects retired after thread exit, by later thread_local destructors, are reclaimed right away
+    }
+
+    if (_Local._Scanning) {
+        return; // retired from a deleter; the outer scan or a later one will get to it
+    }
+
+    _Local._Scanning = true;
+    _Scan();
+    _Local._Scanning = false;
+}
+
+} // extern "C"
@@ -0,0 +1,227 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// implement read-copy-update grace periods and deferred reclamation
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <rcu>
+
+#include <Windows.h>
+
+namespace {
+    // Each reader's state is one word: the nesting depth of its read-side critical sections in the low bits, and the
+    // grace period phase it observed when it entered the outermost one. A grace period flips the global phase twice,
+    // each time waiting for the readers that are still in a critical section entered under the old phase.
+    constexpr unsigned long _Nesting_mask = 0xFFFF;
+    constexpr unsigned long _Phase_bit    = 0x1'0000;
+
+    // Retired objects are handed to a thread pool thread once this many have been queued.
+    constexpr size_t _Reclaim_batch_size = 64;
+
+    // Grace periods wait for readers by polling; they escalate from pausing to yielding to sleeping.
+    constexpr unsigned int _Spins_before_yield  = 1024;
+    constexpr unsigned int _Yields_before_sleep = 64;
+
+    struct alignas(_STD hardware_destructive_interference_size) _Rcu_reader {
+        _STD atomic<unsigned long> _State{0}; // written only by the owning thread
+        _Rcu_reader* _Next = nullptr; // linked into _Readers under _Gp_lock
+        _Rcu_reader* _Prev = nullptr;
+        bool _Registered   = false;
+        bool _Closed       = false; // set on thread exit, for readers in thread_local destructors that run later
+
+        constexpr _Rcu_reader() noexcept = default;
+
+        _Rcu_reader(const _Rcu_reader&)            = delete;
+        _Rcu_reader& operator=(const _Rcu_reader&) = delete;
+
+        ~_Rcu_reader();
+    };
+
+    // _Gp_lock serializes grace periods with each other and with changes to _Readers. A reader only takes it when
+    // its thread first enters a critical section, and when the thread exits.
+    SRWLOCK _Gp_lock      = SRWLOCK_INIT;
+    _Rcu_reader* _Readers = nullptr;
+    _STD atomic<unsigned long> _Gp_phase{1}; // the nesting bits of a fresh reader state; see __std_rcu_read_lock
+
+    thread_local _Rcu_reader _Reader;
+
+    _Rcu_reader::~_Rcu_reader() {
+        if (_Registered) {
+            AcquireSRWLockExclusive(&_Gp_lock);
+            if (_Prev) {
+                _Prev->_Next = _Next;
+            } else {
+                _Readers = _Next;
+            }
+
+            if (_Next) {
+                _Next->_Prev = _Prev;
+            }
+
+            ReleaseSRWLockExclusive(&_Gp_lock);
+            _Registered = false;
+        }
+
+        _Closed = true;
+    }
+
+    void _Register(_Rcu_reader& _Self) noexcept {
+        AcquireSRWLockExclusive(&_Gp_lock);
+        _Self._Next = _Readers;
+        if (_Readers) {
+            _Readers->_Prev = &_Self;
+        }
+
+        _Readers          = &_Self;
+        _Self._Registered = true;
+        ReleaseSRWLockExclusive(&_Gp_lock);
+    }
+
+    [[nodiscard]] bool _Is_blocking(const _Rcu_reader& _Reader_state, const unsigned long _Phase) noexcept {
+        const auto _State = _Reader_state._State.load(_STD memory_order_acquire);
+        return (_State & _Nesting_mask) != 0 && ((_State ^ _Phase) & _Phase_bit) != 0;
+    }
+
+    void _Flip_phase_and_wait() noexcept { // _Gp_lock must be held exclusively
+        const auto _Phase = _Gp_phase.load(_STD memory_order_relaxed) ^ _Phase_bit;
+        _Gp_phase.store(_Phase, _STD memory_order_seq_cst);
+        _STD atomic_thread_fence(_STD memory_order_seq_cst);
+
+        for (auto _Reader_state = _Readers; _Reader_state; _Reader_state = _Reader_state->_Next) {
+            unsigned int _Polls = 0;
+            while (_Is_blocking(*_Reader_state, _Phase)) {
+                ++_Polls;
+                if (_Polls < _Spins_before_yield) {
+                    YieldProcessor();
+                } else if (_Polls < _Spins_before_yield + _Yields_before_sleep) {
+                    SwitchToThread();
+                } else {
+                    Sleep(1);
+                }
+            }
+        }
+    }
+
+    _STD atomic<__std_rcu_retired*> _Pending{nullptr};
+    _STD atomic<size_t> _Pending_count{0};
+    _STD atomic<bool> _Reclaimer_scheduled{false};
+    _STD atomic<size_t> _Reclaimers_in_flight{0};
+
+    void _Reclaim_pending() noexcept { // must be called outside of any read-side critical section
+        auto _List = _Pending.exchange(nullptr, _STD memory_order_acquire);
+        if (!_List) {
+            return;
+        }
+
+        size_t _Taken = 0;
+        for (auto _Node = _List; _Node; _Node = _Node->_Next) {
+            ++_Taken;
+        }
+
+        _Pending_count.fetch_sub(_Taken, _STD memory_order_relaxed);
+
+        __std_rcu_synchronize();
+        while (_List) {
+            const auto _Node = _List;
+            _List            = _Node->_Next; // _Node is destroyed below
+            _Node->_Reclaim(_Node);
+        }
+    }
+
+    void _Reclaimer_done() noexcept {
+        if (_Reclaimers_in_flight.fetch_sub(1, _STD memory_order_release) == 1) {
+            _Reclaimers_in_flight.notify_all();
+        }
+    }
+
+    void CALLBACK _Reclaim_callback(PTP_CALLBACK_INSTANCE, void*) noexcept {
+        // Clear the flag first, so that objects retired while this batch waits for its grace period can schedule
+        // another reclaimer rather than waiting for the next batch.
+        _Reclaimer_scheduled.store(false, _STD memory_order_relaxed);
+        _Reclaim_pending();
+        _Reclaimer_done();
+    }
+} // unnamed namespace
+
+extern "C" {
+
+void __stdcall __std_rcu_read_lock() noexcept {
+    auto& _Self       = _Reader;
+    const auto _State = _Self._State.load(_STD memory_order_relaxed);
+    if ((_State & _Nesting_mask) != 0) {
+        _Self._State.store(_State + 1, _STD memory_order_relaxed);
+        return;
+    }
+
+    if (_Self._Closed) {
+        // This thread's reader state was destroyed; block grace periods the slow way instead.
+        AcquireSRWLockShared(&_Gp_lock);
+        _Self._State.store(1, _STD memory_order_relaxed);
+        return;
+    }
+
+    if (!_Self._Registered) {
+        _Register(_Self);
+    }
+
+    _Self._State.store(_Gp_phase.load(_STD memory_order_relaxed), _STD memory_order_relaxed);
+    // The reader's half of an asymmetric fence: a compiler barrier keeps the critical section's loads after the store
+    // above, and grace periods issue a process-wide barrier (FlushProcessWriteBuffers) before and after waiting.
+    _STD atomic_signal_fence(_STD memory_order_seq_cst);
+}
+
+void __stdcall __std_rcu_read_unlock() noexcept {
+    auto& _Self       = _Reader;
+    const auto _State = _Self._State.load(_STD memory_order_relaxed);
+    _STD atomic_signal_fence(_STD memory_order_seq_cst);
+    _Self._State.store(_State - 1, _STD memory_order_release);
+
+    if (_Self._Closed && (_State & _Nesting_mask) == 1) {
+        ReleaseSRWLockShared(&_Gp_lock);
+    }
+}
+
+void __stdcall __std_rcu_synchronize() noexcept {
+    FlushProcessWriteBuffers();
+    AcquireSRWLockExclusive(&_Gp_lock);
+    // Two flips: a reader may have loaded the phase just before the first one and published it just after.
+    _Flip_phase_and_wait();
+    _Flip_phase_and_wait();
+    ReleaseSRWLockExclusive(&_Gp_lock);
+    FlushProcessWriteBuffers();
+}
+
+void __stdcall __std_rcu_retire(__std_rcu_retired* const _Retired) noexcept {
+    // counted before it's published, so that _Reclaim_pending never takes more than has been counted
+    const size_t _Count = _Pending_count.fetch_add(1, _STD memory_order_relaxed) + 1;
+    _Retired->_Next     = _Pending.load(_STD memory_order_relaxed);
+    while (!_Pending.compare_exchange_weak(_Retired->_Next, _Retired, _STD memory_order_release)) {
+    }
+
+    if (_Count < _Reclaim_batch_size || _Reclaimer_scheduled.exchange(true, _STD memory_order_relaxed)) {
+        return;
+    }
+
+    _Reclaimers_in_flight.fetch_add(1, _STD memory_order_relaxed);
+    if (!TrySubmitThreadpoolCallback(_Reclaim_callback, nullptr, nullptr)) {
+        // Leave the batch queued; a later retirement or rcu_barrier will reclaim it. This may be called from a
+        // read-side critical section, so it can't wait for a grace period itself.
+        _Reclaimer_scheduled.store(false, _STD memory_order_relaxed);
+        _Reclaimer_done();
+    }
+}
+
+void __stdcall __std_rcu_barrier() noexcept {
+    _Reclaim_pending();
+
+    // Batches taken by thread pool callbacks before this call may still be waiting for their grace periods.
+    auto _In_flight = _Reclaimers_in_flight.load(_STD memory_order_acquire);
+    while (_In_flight != 0) {
+        _Reclaimers_in_flight.wait(_In_flight, _STD memory_order_acquire);
+        _In_flight = _Reclaimers_in_flight.load(_STD memory_order_acquire);
+    }
+}
+
+} // extern "C"
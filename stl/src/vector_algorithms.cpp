@@ -5289,6 +5289,65 @@ namespace {
             }
         }
 
+        template <class _Traits, class _Ty>
+        const void* _Search_two_anchor(const void* _First1, const void* const _Last1, const void* const _First2,
+            const size_t _Size_bytes_2) noexcept {
+            // Each vector of candidate positions is compared against both the first and the last element of the
+            // needle, and only the positions where both match are verified. The haystack must have room for at least
+            // _Vec_size bytes of candidate positions, and the needle must have at least two elements.
+            [[maybe_unused]] typename _Traits::_Guard _Guard; // TRANSITION, DevCom-10331414
+            constexpr size_t _Vec_size = _Traits::_Vec_size;
+            const size_t _Last_offset  = _Size_bytes_2 - sizeof(_Ty);
+            const size_t _Mid_size     = _Last_offset - sizeof(_Ty);
+
+            const void* _Last2 = _First2;
+            _Advance_bytes(_Last2, _Last_offset);
+            const void* _Mid2 = _First2;
+            _Advance_bytes(_Mid2, sizeof(_Ty));
+
+            const auto _Start2 = _Traits::_Broadcast(_Traits::_Load_tail(_First2, sizeof(_Ty)));
+            const auto _End2   = _Traits::_Broadcast(_Traits::_Load_tail(_Last2, sizeof(_Ty)));
+
+            // The last vector of candidates ends at the last position where the needle fits; it may overlap the
+            // vector before it, which only rechecks positions that were already rejected.
+            const void* _Stop1 = _First1;
+            _Advance_bytes(_Stop1, _Byte_length(_First1, _Last1) - _Size_bytes_2 - (_Vec_size - sizeof(_Ty)));
+
+            for (;;) {
+                const void* _Tail1 = _First1;
+                _Advance_bytes(_Tail1, _Last_offset);
+
+                const auto _Data1      = _Traits::_Load(_First1);
+                const auto _Data1_tail = _Traits::_Load(_Tail1);
+                unsigned long _Bingo   = _Traits::_Cmp(_Data1, _Start2) & _Traits::_Cmp(_Data1_tail, _End2);
+
+                while (_Bingo != 0) {
+                    const unsigned int _Pos = _Traits::_Bsf(_Bingo);
+
+                    const void* _Match = _First1;
+                    _Advance_bytes(_Match, _Pos);
+
+                    const void* _Mid1 = _Match;
+                    _Advance_bytes(_Mid1, sizeof(_Ty));
+
+                    if (memcmp(_Mid1, _Mid2, _Mid_size) == 0) {
+                        return _Match;
+                    }
+
+                    _Bingo ^= 1 << _Pos;
+                }
+
+                if (_First1 == _Stop1) {
+                    return _Last1;
+                }
+
+                _Advance_bytes(_First1, _Vec_size);
+                if (_First1 > _Stop1) {
+                    _First1 = _Stop1;
+                }
+            }
+        }
+
         template <class _Traits, class _Ty>
         const void* _Find_end_cmpeq(const void* const _First1, const void* const _Last1, const void* const _First2,
             const size_t _Size_bytes_2) noexcept {
@@ -5465,6 +5524,42 @@ namespace {
         }
 #endif // ^^^ !defined(_M_ARM64EC) ^^^
 
+        // Horspool's algorithm skips ahead by up to the length of the needle, but on log-like text it only beats
+        // cmpestri for long needles, and it never beats _Search_two_anchor. It's used for 1-byte elements only, so
+        // that its skip table stays small.
+        constexpr size_t _Horspool_min_haystack_bytes     = 4096;
+        constexpr size_t _Horspool_min_needle_bytes       = 8; // when the only alternative is the scalar loop
+        constexpr size_t _Horspool_min_needle_bytes_sse42 = 256;
+
+        const void* _Search_horspool(const void* const _First1, const void* const _Last1, const void* const _First2,
+            const size_t _Size_bytes_2) noexcept { // the algorithm of boyer_moore_horspool_searcher
+            const auto _Haystack   = static_cast<const unsigned char*>(_First1);
+            const auto _Needle     = static_cast<const unsigned char*>(_First2);
+            const size_t _Last_idx = _Size_bytes_2 - 1;
+
+            size_t _Skip[256];
+            for (auto& _Distance : _Skip) {
+                _Distance = _Size_bytes_2;
+            }
+
+            for (size_t _Idx = 0; _Idx != _Last_idx; ++_Idx) {
+                _Skip[_Needle[_Idx]] = _Last_idx - _Idx;
+            }
+
+            const unsigned char _Needle_last = _Needle[_Last_idx];
+            const size_t _Max_pos            = _Byte_length(_First1, _Last1) - _Size_bytes_2;
+            for (size_t _Pos = 0; _Pos <= _Max_pos;) {
+                const unsigned char _Haystack_last = _Haystack[_Pos + _Last_idx];
+                if (_Haystack_last == _Needle_last && memcmp(_Haystack + _Pos, _Needle, _Last_idx) == 0) {
+                    return _Haystack + _Pos;
+                }
+
+                _Pos += _Skip[_Haystack_last];
+            }
+
+            return _Last1;
+        }
+
         template <class _FindTraits, class _Traits_avx, class _Traits_sse, class _Ty>
         const void* __stdcall _Search_impl(
             const void* _First1, const void* const _Last1, const void* const _First2, const size_t _Count2) noexcept {
@@ -5485,6 +5580,14 @@ namespace {
             }
 
 #ifndef _M_ARM64EC
+            if constexpr (sizeof(_Ty) <= 2) {
+                // Matching a single element has too many false starts for 8-bit and 16-bit text, but matching the
+                // first and the last element rejects almost all of them
+                if (_Use_avx2() && _Size_bytes_1 - _Size_bytes_2 >= 32 - sizeof(_Ty)) {
+                    return _Search_two_anchor<_Traits_avx, _Ty>(_First1, _Last1, _First2, _Size_bytes_2);
+                }
+            }
+
             // The AVX2 path for 8-bit elements is not necessarily more efficient than the SSE4.2 cmpestri path
             if constexpr (sizeof(_Ty) != 1) {
                 if (_Use_avx2() && _Size_bytes_1 >= 32) {
@@ -5496,6 +5599,13 @@ namespace {
                 if constexpr (sizeof(_Ty) >= 4) {
                     return _Search_cmpeq<_Traits_sse, _Ty>(_First1, _Last1, _First2, _Size_bytes_2);
                 } else {
+                    if constexpr (sizeof(_Ty) == 1) {
+                        if (_Size_bytes_2 >= _Horspool_min_needle_bytes_sse42
+                            && _Size_bytes_1 >= _Horspool_min_haystack_bytes) {
+                            return _Search_horspool(_First1, _Last1, _First2, _Size_bytes_2);
+                        }
+                    }
+
                     constexpr int _Op =
                         (sizeof(_Ty) == 1 ? _SIDD_UBYTE_OPS : _SIDD_UWORD_OPS) | _SIDD_CMP_EQUAL_ORDERED;
                     constexpr int _Part_size_el = sizeof(_Ty) == 1 ? 16 : 8;
@@ -5599,6 +5709,12 @@ namespace {
             }
 #endif // ^^^ !defined(_M_ARM64EC) ^^^
 
+            if constexpr (sizeof(_Ty) == 1) {
+                if (_Size_bytes_2 >= _Horspool_min_needle_bytes && _Size_bytes_1 >= _Horspool_min_haystack_bytes) {
+                    return _Search_horspool(_First1, _Last1, _First2, _Size_bytes_2);
+                }
+            }
+
             const size_t _Max_pos = _Size_bytes_1 - _Size_bytes_2 + sizeof(_Ty);
 
             auto _Ptr1         = static_cast<const _Ty*>(_First1);
@@ -5891,7 +6007,8 @@ extern "C" {
 
 const void* __stdcall __std_search_1(
     const void* const _First1, const void* const _Last1, const void* const _First2, const size_t _Count2) noexcept {
-    return _Find_seq::_Search_impl<_Finding::_Find_traits_1, void, void, uint8_t>(_First1, _Last1, _First2, _Count2);
+    return _Find_seq::_Search_impl<_Finding::_Find_traits_1, _Find_seq::_Find_seq_traits_avx_1, void, uint8_t>(
+        _First1, _Last1, _First2, _Count2);
 }
 
 const void* __stdcall __std_search_2(
@@ -296,6 +296,22 @@ void test_generator() {
     constexpr int bound = 42;
     assert(ranges::equal(some_ints(bound), views::iota(0, bound)));
 }
+
+void test_hazard_pointer() {
+    using namespace std;
+    puts("Testing <hazard_pointer>.");
+    struct node : hazard_pointer_obj_base<node> {
+        int value = 1729;
+    };
+    atomic<node*> src{new node};
+    hazard_pointer hp = make_hazard_pointer();
+    assert(!hp.empty());
+    node* const p = hp.protect(src);
+    assert(p->value == 1729);
+    src.store(nullptr);
+    p->retire();
+    hp.reset_protection();
+}
 #endif // TEST_STANDARD >= 23
 
 void test_initializer_list() {
@@ -651,6 +667,23 @@ void test_ratio() {
     static_assert(ratio_equal_v<ratio_multiply<milli, hecto>, deci>);
 }
 
+#if TEST_STANDARD >= 23
+void test_rcu() {
+    using namespace std;
+    puts("Testing <rcu>.");
+    struct node : rcu_obj_base<node> {
+        int value = 1729;
+    };
+    atomic<node*> src{new node};
+    {
+        scoped_lock lock{rcu_default_domain()};
+        assert(src.load()->value == 1729);
+    }
+    src.exchange(nullptr)->retire();
+    rcu_barrier();
+}
+#endif // TEST_STANDARD >= 23
+
 void test_regex() {
     using namespace std;
     puts("Testing <regex>.");
@@ -1198,6 +1231,7 @@ void all_cpp_header_tests() {
     test_future();
 #if TEST_STANDARD >= 23
     test_generator();
+    test_hazard_pointer();
 #endif // TEST_STANDARD >= 23
     test_initializer_list();
     test_iomanip();
@@ -1229,6 +1263,9 @@ void all_cpp_header_tests() {
     test_random();
     test_ranges();
     test_ratio();
+#if TEST_STANDARD >= 23
+    test_rcu();
+#endif // TEST_STANDARD >= 23
     test_regex();
     test_scoped_allocator();
     test_semaphore();
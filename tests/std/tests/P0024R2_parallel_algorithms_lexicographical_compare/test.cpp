@@ -0,0 +1,131 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+// compares only the low bits, so that non-equal elements can be equivalent
+const auto low_bits_less = [](int a, int b) { return (a & 0xF) < (b & 0xF); };
+
+template <class Container, class Pred>
+void check_against_serial(const Container& left, const Container& right, Pred pred) {
+    const bool expected = lexicographical_compare(left.begin(), left.end(), right.begin(), right.end(), pred);
+    assert(lexicographical_compare(par, left.begin(), left.end(), right.begin(), right.end(), pred) == expected);
+    assert(lexicographical_compare(par_unseq, left.begin(), left.end(), right.begin(), right.end(), pred) == expected);
+}
+
+template <template <class...> class Container, class T>
+void test_case_lexicographical_compare_positions(const size_t testSize) {
+    Container<T> left(testSize);
+    Container<T> right(testSize);
+    assert(!lexicographical_compare(par, left.begin(), left.end(), right.begin(), right.end()));
+
+    // each difference position, in both directions
+    auto leftIt  = left.begin();
+    auto rightIt = right.begin();
+    for (auto remainingAttempts = quadratic_complexity_case_limit; remainingAttempts != 0; --remainingAttempts) {
+        if (leftIt == left.end()) {
+            break;
+        }
+
+        *rightIt = static_cast<T>(1);
+        assert(lexicographical_compare(par, left.begin(), left.end(), right.begin(), right.end()));
+        assert(!lexicographical_compare(par, right.begin(), right.end(), left.begin(), left.end()));
+        assert(!lexicographical_compare(par, left.begin(), left.end(), right.begin(), right.end(), greater<>{}));
+        check_against_serial(left, right, less<T>{});
+        check_against_serial(left, right, greater<T>{});
+
+        // a later, opposite difference must not change the answer
+        if (next(leftIt) != left.end()) {
+            *next(leftIt) = static_cast<T>(2);
+            assert(lexicographical_compare(par, left.begin(), left.end(), right.begin(), right.end()));
+            *next(leftIt) = T{};
+        }
+
+        *rightIt = T{};
+        ++leftIt;
+        ++rightIt;
+    }
+}
+
+template <template <class...> class Container1, template <class...> class Container2>
+void test_case_lexicographical_compare_lengths(const size_t testSize) {
+    Container1<int> shorter(testSize, 7);
+    Container2<int> longer(testSize, 7);
+    longer.insert(longer.end(), 7);
+
+    assert(lexicographical_compare(par, shorter.begin(), shorter.end(), longer.begin(), longer.end()));
+    assert(!lexicographical_compare(par, longer.begin(), longer.end(), shorter.begin(), shorter.end()));
+    assert(!lexicographical_compare(par, shorter.begin(), shorter.end(), shorter.begin(), shorter.end()));
+    assert(lexicographical_compare(par, shorter.begin(), shorter.end(), longer.begin(), longer.end(), greater<>{}));
+}
+
+void test_case_lexicographical_compare_equivalent_elements(const size_t testSize) {
+    // elements differing only in the high bits are equivalent under low_bits_less
+    vector<int> left(testSize);
+    vector<int> right(testSize);
+    for (size_t i = 0; i < testSize; ++i) {
+        left[i]  = static_cast<int>(i % 16);
+        right[i] = static_cast<int>(i % 16) + 0x100;
+    }
+
+    check_against_serial(left, right, low_bits_less);
+    assert(!lexicographical_compare(par, left.begin(), left.end(), right.begin(), right.end(), low_bits_less));
+    if (testSize != 0) {
+        right.back() = (right.back() & ~0xF) | 0xF;
+        check_against_serial(left, right, low_bits_less);
+        assert(lexicographical_compare(par, left.begin(), left.end(), right.begin(), right.end(), low_bits_less)
+               == (left.back() != 0xF));
+    }
+}
+
+void test_case_lexicographical_compare_pointers(const size_t testSize) {
+    // pointers are their own unwrapped iterators, which take the vectorized equality path for these predicates
+    vector<int> left(testSize, 3);
+    vector<int> right(testSize, 3);
+    int* const leftFirst        = left.data();
+    int* const leftLast         = leftFirst + testSize;
+    const int* const rightFirst = right.data();
+    const int* const rightLast  = rightFirst + testSize;
+    assert(!lexicographical_compare(par, leftFirst, leftLast, rightFirst, rightLast));
+    assert(!lexicographical_compare(par, leftFirst, leftLast, rightFirst, rightLast, less<>{}));
+    assert(!lexicographical_compare(par_unseq, leftFirst, leftLast, rightFirst, rightLast, greater<int>{}));
+    if (testSize != 0) {
+        right[testSize / 2] = 4;
+        assert(lexicographical_compare(par, leftFirst, leftLast, rightFirst, rightLast));
+        assert(!lexicographical_compare(par, rightFirst, rightLast, leftFirst, leftLast, less<>{}));
+        assert(!lexicographical_compare(par_unseq, leftFirst, leftLast, rightFirst, rightLast, greater<>{}));
+        assert(lexicographical_compare(par, leftFirst, leftLast, rightFirst, rightLast, low_bits_less));
+        assert(lexicographical_compare(par, leftFirst, leftLast - 1, rightFirst, rightLast - 1) == (testSize > 2));
+    }
+}
+
+int main() {
+    parallel_test_case(test_case_lexicographical_compare_positions<forward_list, int>);
+    parallel_test_case(test_case_lexicographical_compare_positions<list, int>);
+    parallel_test_case(test_case_lexicographical_compare_positions<vector, int>);
+    parallel_test_case(test_case_lexicographical_compare_positions<vector, unsigned char>);
+    parallel_test_case(test_case_lexicographical_compare_positions<vector, short>);
+    parallel_test_case(test_case_lexicographical_compare_positions<vector, long long>);
+    parallel_test_case(test_case_lexicographical_compare_positions<vector, double>);
+
+    parallel_test_case(test_case_lexicographical_compare_lengths<vector, vector>);
+    parallel_test_case(test_case_lexicographical_compare_lengths<list, list>);
+    parallel_test_case(test_case_lexicographical_compare_lengths<forward_list, vector>);
+    parallel_test_case(test_case_lexicographical_compare_lengths<vector, list>);
+
+    parallel_test_case(test_case_lexicographical_compare_equivalent_elements);
+    parallel_test_case(test_case_lexicographical_compare_pointers);
+}
@@ -0,0 +1,186 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+template <class T>
+void test_atomic_arithmetic() {
+    atomic<T> a{T{10}};
+    assert(a.fetch_max(T{20}) == T{10});
+    assert(a.load() == T{20});
+    assert(a.fetch_max(T{5}) == T{20}); // stored value dominates; unchanged
+    assert(a.load() == T{20});
+    assert(a.fetch_min(T{7}, memory_order_relaxed) == T{20});
+    assert(a.load() == T{7});
+    assert(a.fetch_min(T{9}, memory_order_acq_rel) == T{7});
+    assert(a.load() == T{7});
+    assert(a.fetch_max(T{7}, memory_order_release) == T{7});
+    assert(a.load() == T{7});
+
+    assert(atomic_fetch_max(&a, T{8}) == T{7});
+    assert(atomic_fetch_min(&a, T{3}) == T{8});
+    assert(atomic_fetch_max_explicit(&a, T{4}, memory_order_acquire) == T{3});
+    assert(atomic_fetch_min_explicit(&a, T{1}, memory_order_seq_cst) == T{4});
+    assert(a.load() == T{1});
+
+    volatile atomic<T> v{T{1}};
+    assert(v.fetch_max(T{2}) == T{1});
+    assert(v.fetch_min(T{0}, memory_order_relaxed) == T{2});
+    assert(atomic_fetch_max(&v, T{5}) == T{0});
+    assert(atomic_fetch_min_explicit(&v, T{3}, memory_order_consume) == T{5});
+    assert(v.load() == T{3});
+
+    if constexpr (is_signed_v<T>) {
+        atomic<T> s{T{0}};
+        assert(s.fetch_min(numeric_limits<T>::lowest()) == T{0});
+        assert(s.fetch_max(T{-1}) == numeric_limits<T>::lowest());
+        assert(s.load() == T{-1});
+    } else {
+        atomic<T> u{T{0}};
+        assert(u.fetch_max(numeric_limits<T>::max()) == T{0});
+        assert(u.fetch_min(T{1}) == numeric_limits<T>::max());
+        assert(u.load() == T{1});
+    }
+
+    T underlying{T{50}};
+    const atomic_ref<T> r{underlying};
+    assert(r.fetch_max(T{60}) == T{50});
+    assert(r.fetch_min(T{40}, memory_order_relaxed) == T{60});
+    assert(r.fetch_max(T{30}) == T{40});
+    assert(underlying == T{40});
+}
+
+void test_atomic_pointer() {
+    int arr[4]{};
+    atomic<int*> p{arr + 1};
+    assert(p.fetch_max(arr + 3) == arr + 1);
+    assert(p.fetch_max(arr) == arr + 3);
+    assert(p.fetch_min(arr + 2, memory_order_acq_rel) == arr + 3);
+    assert(atomic_fetch_min(&p, arr + 0) == arr + 2);
+    assert(atomic_fetch_max_explicit(&p, arr + 1, memory_order_relaxed) == arr + 0);
+    assert(p.load() == arr + 1);
+
+    volatile atomic<int*> v{arr};
+    assert(v.fetch_max(arr + 2) == arr);
+    assert(v.fetch_min(arr + 1) == arr + 2);
+
+    int* underlying = arr + 2;
+    const atomic_ref<int*> r{underlying};
+    assert(r.fetch_min(arr) == arr + 2);
+    assert(r.fetch_max(arr + 3) == arr);
+    assert(underlying == arr + 3);
+}
+
+template <class T>
+void test_floating_special_values() {
+    constexpr T nan = numeric_limits<T>::quiet_NaN();
+    constexpr T inf = numeric_limits<T>::infinity();
+
+    // NaN is ignored as an operand and replaced as a stored value, like fmax and fmin do
+    atomic<T> a{T{1}};
+    assert(a.fetch_max(nan) == T{1});
+    assert(a.fetch_min(nan) == T{1});
+    assert(a.load() == T{1});
+
+    a.store(nan);
+    assert(isnan(a.fetch_max(T{2})));
+    assert(a.load() == T{2});
+    a.store(nan);
+    assert(isnan(a.fetch_min(T{-2})));
+    assert(a.load() == T{-2});
+    a.store(nan);
+    assert(isnan(a.fetch_min(nan)));
+    assert(isnan(a.load()));
+
+    a.store(T{0});
+    assert(a.fetch_max(inf) == T{0});
+    assert(a.fetch_min(-inf) == inf);
+    assert(a.load() == -inf);
+
+    T underlying = nan;
+    const atomic_ref<T> r{underlying};
+    assert(isnan(r.fetch_max(T{3})));
+    assert(r.fetch_min(T{1}) == T{3});
+    assert(underlying == T{1});
+}
+
+template <class T>
+void test_concurrent() {
+    // every thread pushes both bounds; the winners must be the extreme values any thread offered
+    constexpr int thread_count = 4;
+    constexpr int per_thread   = 10'000;
+
+    atomic<T> high{T{0}};
+    atomic<T> low{T{100}};
+    vector<thread> threads;
+    for (int t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < per_thread; ++i) {
+                const T value = static_cast<T>((i * thread_count + t) % 100);
+                const T old_high = high.fetch_max(value, memory_order_relaxed);
+                assert(old_high <= high.load(memory_order_relaxed));
+                low.fetch_min(value, memory_order_relaxed);
+            }
+        });
+    }
+
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    assert(high.load() == T{99});
+    assert(low.load() == T{0});
+}
+
+template <class A, class T>
+concept can_fetch_max = requires(A& a, T t) { a.fetch_max(t); };
+
+static_assert(can_fetch_max<atomic<int>, int>);
+static_assert(can_fetch_max<atomic<double>, double>);
+static_assert(can_fetch_max<atomic<int*>, int*>);
+static_assert(can_fetch_max<const atomic_ref<int>, int>);
+static_assert(!can_fetch_max<atomic<bool>, bool>);
+static_assert(!can_fetch_max<atomic<void (*)()>, void (*)()>);
+static_assert(same_as<decltype(declval<atomic<long>&>().fetch_min(0L)), long>);
+static_assert(same_as<decltype(declval<const atomic_ref<float>&>().fetch_min(0.0f)), float>);
+
+int main() {
+    test_atomic_arithmetic<signed char>();
+    test_atomic_arithmetic<unsigned char>();
+    test_atomic_arithmetic<short>();
+    test_atomic_arithmetic<unsigned short>();
+    test_atomic_arithmetic<int>();
+    test_atomic_arithmetic<unsigned int>();
+    test_atomic_arithmetic<long>();
+    test_atomic_arithmetic<unsigned long>();
+    test_atomic_arithmetic<long long>();
+    test_atomic_arithmetic<unsigned long long>();
+    test_atomic_arithmetic<char>();
+    test_atomic_arithmetic<wchar_t>();
+    test_atomic_arithmetic<char8_t>();
+    test_atomic_arithmetic<char16_t>();
+    test_atomic_arithmetic<char32_t>();
+    test_atomic_arithmetic<float>();
+    test_atomic_arithmetic<double>();
+    test_atomic_arithmetic<long double>();
+
+    test_atomic_pointer();
+
+    test_floating_special_values<float>();
+    test_floating_special_values<double>();
+    test_floating_special_values<long double>();
+
+    test_concurrent<int>();
+    test_concurrent<unsigned long long>();
+    test_concurrent<double>();
+}
@@ -0,0 +1,230 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <climits>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <forward_list>
+#include <list>
+#include <random>
+#include <ranges>
+#include <span>
+#include <vector>
+
+using namespace std;
+
+// Constexpr-friendly URBG, exercising the generic (non-bulk) paths
+struct xorshift32 {
+    using result_type = uint32_t;
+
+    static constexpr result_type min() {
+        return 0;
+    }
+    static constexpr result_type max() {
+        return UINT32_MAX;
+    }
+
+    constexpr result_type operator()() {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+    uint32_t state = 2463534242u;
+};
+
+// URBG customizing generate_random through a member
+struct member_engine {
+    using result_type = uint32_t;
+
+    static constexpr result_type min() {
+        return 0;
+    }
+    static constexpr result_type max() {
+        return UINT32_MAX;
+    }
+
+    constexpr result_type operator()() {
+        return 7;
+    }
+
+    template <class R>
+    constexpr void generate_random(R&& r) {
+        ++member_calls;
+        ranges::fill(r, 42u);
+    }
+
+    int member_calls = 0;
+};
+
+// Distribution customizing generate_random through a member
+struct member_distribution {
+    template <class G>
+    constexpr int operator()(G&) {
+        return 7;
+    }
+
+    template <class R, class G>
+    constexpr void generate_random(R&& r, G&) {
+        ++member_calls;
+        ranges::fill(r, 1729);
+    }
+
+    int member_calls = 0;
+};
+
+static_assert(same_as<decltype(ranges::generate_random(vector<uint32_t>(3), declval<mt19937&>())), ranges::dangling>);
+static_assert(same_as<decltype(ranges::generate_random(declval<vector<uint32_t>&>(), declval<mt19937&>())),
+    vector<uint32_t>::iterator>);
+static_assert(same_as<decltype(ranges::generate_random(declval<span<int>>(), declval<mt19937&>(),
+                          declval<uniform_int_distribution<int>&>())),
+    span<int>::iterator>);
+
+constexpr bool test_constexpr() {
+    {
+        array<uint32_t, 5> arr{};
+        xorshift32 gen;
+        xorshift32 ref;
+        const auto it = ranges::generate_random(arr, gen);
+        assert(it == arr.end());
+        for (const auto& elem : arr) {
+            assert(elem == ref());
+        }
+        assert(gen.state == ref.state);
+    }
+    {
+        array<uint32_t, 3> arr{};
+        member_engine gen;
+        assert(ranges::generate_random(arr.begin(), arr.end(), gen) == arr.end());
+        assert(gen.member_calls == 1);
+        assert(ranges::all_of(arr, [](uint32_t x) { return x == 42; }));
+    }
+    {
+        array<int, 3> arr{};
+        xorshift32 gen;
+        member_distribution dist;
+        assert(ranges::generate_random(arr, gen, dist) == arr.end());
+        assert(dist.member_calls == 1);
+        assert(ranges::all_of(arr, [](int x) { return x == 1729; }));
+    }
+
+    return true;
+}
+
+constexpr size_t sizes[] = {0, 1, 2, 255, 256, 257, 623, 624, 625, 1000, 1248, 5000};
+
+template <class Container, class Engine>
+void test_engine_into() {
+    for (const size_t n : sizes) {
+        // Skip a few values first, so that the engine doesn't start at a refill boundary.
+        for (const size_t skip : {size_t{0}, size_t{1}, size_t{311}}) {
+            Engine gen;
+            Engine ref;
+            gen.discard(skip);
+            ref.discard(skip);
+
+            Container c(n);
+            const auto it = ranges::generate_random(c, gen);
+            assert(it == c.end());
+            for (const auto& elem : c) {
+                assert(elem == ref());
+            }
+            assert(gen == ref);
+        }
+    }
+}
+
+template <class Engine>
+void test_engine() {
+    using T = typename Engine::result_type;
+    test_engine_into<vector<T>, Engine>(); // contiguous, writes directly into the destination
+    test_engine_into<list<T>, Engine>(); // sized, buffered
+    test_engine_into<vector<long double>, Engine>(); // converting, buffered
+
+    { // not sized
+        Engine gen;
+        Engine ref;
+        forward_list<T> fl(100);
+        assert(ranges::generate_random(fl, gen) == fl.end());
+        for (const auto& elem : fl) {
+            assert(elem == ref());
+        }
+        assert(gen == ref);
+    }
+
+    { // iterator and sentinel
+        Engine gen;
+        Engine ref;
+        vector<T> v(700);
+        const same_as<typename vector<T>::iterator> auto it = ranges::generate_random(v.begin(), v.end(), gen);
+        assert(it == v.end());
+        for (const auto& elem : v) {
+            assert(elem == ref());
+        }
+        assert(gen == ref);
+    }
+}
+
+template <class Dist, class Engine>
+void test_distribution(Dist dist) {
+    for (const size_t n : sizes) {
+        Engine gen;
+        Engine ref;
+        Dist ref_dist = dist;
+
+        vector<typename Dist::result_type> v(n);
+        assert(ranges::generate_random(v, gen, dist) == v.end());
+        for (const auto& elem : v) {
+            assert(elem == ref_dist(ref));
+        }
+        assert(gen == ref);
+
+        list<typename Dist::result_type> l(n);
+        assert(ranges::generate_random(l.begin(), l.end(), gen, dist) == l.end());
+        for (const auto& elem : l) {
+            assert(elem == ref_dist(ref));
+        }
+        assert(gen == ref);
+    }
+}
+
+template <class Engine>
+void test_distributions() {
+    test_distribution<uniform_int_distribution<int>, Engine>(uniform_int_distribution<int>{0, 99});
+    test_distribution<uniform_int_distribution<int>, Engine>(uniform_int_distribution<int>{-1'000'000, 1'000'000});
+    test_distribution<uniform_int_distribution<int>, Engine>(uniform_int_distribution<int>{INT_MIN, INT_MAX});
+    test_distribution<uniform_int_distribution<short>, Engine>(uniform_int_distribution<short>{-5, 5});
+    test_distribution<uniform_int_distribution<unsigned short>, Engine>(uniform_int_distribution<unsigned short>{});
+    // About 30% of draws are rejected for this range when the engine produces 32 bits.
+    test_distribution<uniform_int_distribution<unsigned int>, Engine>(
+        uniform_int_distribution<unsigned int>{0, 3'000'000'000u});
+    test_distribution<uniform_int_distribution<unsigned long long>, Engine>(
+        uniform_int_distribution<unsigned long long>{0, 12'000'000'000'000'000'000ull});
+    test_distribution<uniform_int_distribution<long long>, Engine>(uniform_int_distribution<long long>{});
+
+    test_distribution<uniform_real_distribution<float>, Engine>(uniform_real_distribution<float>{});
+    test_distribution<uniform_real_distribution<double>, Engine>(uniform_real_distribution<double>{-3.0, 17.5});
+    test_distribution<uniform_real_distribution<long double>, Engine>(uniform_real_distribution<long double>{});
+
+    // no bulk path; exercises the generic fallback
+    test_distribution<normal_distribution<double>, Engine>(normal_distribution<double>{});
+}
+
+int main() {
+    static_assert(test_constexpr());
+    assert(test_constexpr());
+
+    test_engine<mt19937>();
+    test_engine<mt19937_64>();
+    test_engine<minstd_rand>();
+    test_engine<ranlux24>();
+
+    test_distributions<mt19937>();
+    test_distributions<mt19937_64>();
+    test_distributions<minstd_rand>();
+}
@@ -38,6 +38,7 @@ import <functional>;
 import <future>;
 #if TEST_STANDARD >= 23
 import <generator>;
+import <hazard_pointer>;
 #endif // TEST_STANDARD >= 23
 import <initializer_list>;
 import <iomanip>;
@@ -69,6 +70,9 @@ import <queue>;
 import <random>;
 import <ranges>;
 import <ratio>;
+#if TEST_STANDARD >= 23
+import <rcu>;
+#endif // TEST_STANDARD >= 23
 import <regex>;
 import <scoped_allocator>;
 import <semaphore>;
@@ -0,0 +1,243 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <hazard_pointer>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+atomic<int> live_nodes{0};
+
+struct node : hazard_pointer_obj_base<node> {
+    explicit node(int v) noexcept : value(v) {
+        ++live_nodes;
+    }
+
+    node(const node&)            = delete;
+    node& operator=(const node&) = delete;
+
+    ~node() {
+        value = -1;
+        --live_nodes;
+    }
+
+    int value;
+};
+
+struct counted;
+
+struct counting_deleter {
+    int* count;
+
+    void operator()(counted* ptr) const noexcept;
+};
+
+struct counted : hazard_pointer_obj_base<counted, counting_deleter> {};
+
+void counting_deleter::operator()(counted* const ptr) const noexcept {
+    ++*count;
+    delete ptr;
+}
+
+// A deleter that retires another object, to exercise retire() being called during reclamation.
+struct chaining_node : hazard_pointer_obj_base<chaining_node> {
+    chaining_node* next = nullptr;
+
+    ~chaining_node() {
+        if (next) {
+            next->retire();
+        }
+    }
+};
+
+static_assert(is_nothrow_default_constructible_v<hazard_pointer>);
+static_assert(is_nothrow_move_constructible_v<hazard_pointer>);
+static_assert(is_nothrow_move_assignable_v<hazard_pointer>);
+static_assert(!is_copy_constructible_v<hazard_pointer>);
+static_assert(!is_copy_assignable_v<hazard_pointer>);
+static_assert(is_nothrow_swappable_v<hazard_pointer>);
+static_assert(is_same_v<decltype(make_hazard_pointer()), hazard_pointer>);
+static_assert(!is_default_constructible_v<hazard_pointer_obj_base<node>>);
+
+// Retire enough unrelated objects to be sure that at least one reclamation scan runs.
+void force_scans() {
+    for (int i = 0; i < 10'000; ++i) {
+        (new node{i})->retire();
+    }
+}
+
+void test_empty_and_swap() {
+    hazard_pointer empty_hp;
+    assert(empty_hp.empty());
+
+    hazard_pointer hp = make_hazard_pointer();
+    assert(!hp.empty());
+
+    swap(empty_hp, hp);
+    assert(!empty_hp.empty());
+    assert(hp.empty());
+
+    hp.swap(empty_hp);
+    assert(!hp.empty());
+    assert(empty_hp.empty());
+
+    hazard_pointer moved{move(hp)};
+    assert(!moved.empty());
+    assert(hp.empty());
+
+    hp = move(moved);
+    assert(!hp.empty());
+    assert(moved.empty());
+
+    hp = hazard_pointer{};
+    assert(hp.empty());
+}
+
+void test_protect_delays_reclamation() {
+    const int before = live_nodes.load();
+
+    atomic<node*> src{new node{42}};
+    hazard_pointer hp = make_hazard_pointer();
+    node* const p     = hp.protect(src);
+    assert(p == src.load());
+
+    src.store(nullptr);
+    p->retire();
+    force_scans();
+    assert(p->value == 42); // still alive
+
+    hp.reset_protection();
+    force_scans();
+    assert(live_nodes.load() - before < 10'000); // reclaimed along with most of the others
+}
+
+void test_try_protect() {
+    node* const first  = new node{1};
+    node* const second = new node{2};
+    atomic<node*> src{first};
+
+    hazard_pointer hp = make_hazard_pointer();
+    node* ptr         = first;
+    assert(hp.try_protect(ptr, src));
+    assert(ptr == first);
+
+    ptr = second;
+    assert(!hp.try_protect(ptr, src));
+    assert(ptr == first); // updated to the current value
+
+    atomic<node*> null_src{nullptr};
+    node* null_ptr = nullptr;
+    assert(hp.try_protect(null_ptr, null_src));
+    assert(null_ptr == nullptr);
+
+    hp.reset_protection(first);
+    hp.reset_protection(nullptr);
+
+    first->retire();
+    second->retire();
+}
+
+// Objects that aren't reclaimed right away can be reclaimed by later tests, so the counts outlive them.
+int custom_deleted      = 0;
+int thread_exit_deleted = 0;
+
+void test_custom_deleter() {
+    for (int i = 0; i < 10'000; ++i) {
+        (new counted)->retire(counting_deleter{&custom_deleted});
+    }
+
+    assert(custom_deleted > 0);
+}
+
+void test_reclaim_at_thread_exit() {
+    // too few to trigger a scan, but reclaimed when the retiring thread exits
+    thread{[] {
+        for (int i = 0; i < 3; ++i) {
+            (new counted)->retire(counting_deleter{&thread_exit_deleted});
+        }
+    }}.join();
+
+    assert(thread_exit_deleted == 3);
+}
+
+void test_retire_during_reclamation() {
+    chaining_node* head = nullptr;
+    for (int i = 0; i < 10'000; ++i) {
+        const auto n = new chaining_node;
+        n->next      = head;
+        head         = n;
+    }
+
+    head->retire();
+    for (int i = 0; i < 10'000; ++i) {
+        (new chaining_node)->retire();
+    }
+}
+
+void test_many_hazard_pointers() {
+    vector<hazard_pointer> hps;
+    for (int i = 0; i < 100; ++i) {
+        hps.push_back(make_hazard_pointer());
+    }
+
+    vector<node*> nodes;
+    for (int i = 0; i < 100; ++i) {
+        atomic<node*> src{new node{i}};
+        nodes.push_back(hps[static_cast<size_t>(i)].protect(src));
+        nodes.back()->retire();
+    }
+
+    force_scans();
+    for (int i = 0; i < 100; ++i) {
+        assert(nodes[static_cast<size_t>(i)]->value == i);
+    }
+}
+
+void test_concurrent_readers() {
+    constexpr int reader_count = 4;
+    constexpr int replacements = 20'000;
+
+    atomic<node*> src{new node{0}};
+    atomic<bool> done{false};
+
+    vector<thread> readers;
+    for (int i = 0; i < reader_count; ++i) {
+        readers.emplace_back([&] {
+            hazard_pointer hp = make_hazard_pointer();
+            while (!done.load()) {
+                node* const p = hp.protect(src);
+                assert(p->value >= 0);
+                hp.reset_protection();
+            }
+        });
+    }
+
+    for (int i = 1; i <= replacements; ++i) {
+        src.exchange(new node{i})->retire();
+    }
+
+    done.store(true);
+    for (auto& t : readers) {
+        t.join();
+    }
+
+    src.load()->retire();
+}
+
+int main() {
+    test_empty_and_swap();
+    test_protect_delays_reclamation();
+    test_try_protect();
+    test_custom_deleter();
+    test_reclaim_at_thread_exit();
+    test_retire_during_reclamation();
+    test_many_hazard_pointers();
+    test_concurrent_readers();
+}
@@ -0,0 +1,206 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <rcu>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+atomic<int> live_configs{0};
+
+struct config : rcu_obj_base<config> {
+    explicit config(int v) noexcept : value(v) {
+        ++live_configs;
+    }
+
+    config(const config&)            = delete;
+    config& operator=(const config&) = delete;
+
+    ~config() {
+        value = -1;
+        --live_configs;
+    }
+
+    int value;
+};
+
+struct counted;
+
+struct counting_deleter {
+    atomic<int>* count;
+
+    void operator()(counted* ptr) const noexcept;
+};
+
+struct counted : rcu_obj_base<counted, counting_deleter> {};
+
+void counting_deleter::operator()(counted* const ptr) const noexcept {
+    ++*count;
+    delete ptr;
+}
+
+static_assert(!is_copy_constructible_v<rcu_domain>);
+static_assert(!is_copy_assignable_v<rcu_domain>);
+static_assert(!is_default_constructible_v<rcu_domain>);
+static_assert(is_same_v<decltype(rcu_default_domain()), rcu_domain&>);
+static_assert(noexcept(rcu_default_domain()));
+static_assert(noexcept(rcu_synchronize()));
+static_assert(noexcept(rcu_barrier()));
+static_assert(!is_default_constructible_v<rcu_obj_base<config>>);
+
+void test_lockable() {
+    rcu_domain& dom = rcu_default_domain();
+    assert(&dom == &rcu_default_domain());
+
+    dom.lock();
+    dom.lock(); // critical sections nest
+    dom.unlock();
+    dom.unlock();
+
+    assert(dom.try_lock());
+    dom.unlock();
+
+    {
+        scoped_lock lock{dom};
+        unique_lock ulock{dom};
+    }
+
+    rcu_synchronize(); // with no readers
+    rcu_synchronize(dom);
+}
+
+void test_barrier_reclaims_everything() {
+    const int before = live_configs.load();
+    for (int i = 0; i < 1000; ++i) {
+        (new config{i})->retire();
+    }
+
+    rcu_barrier();
+    assert(live_configs.load() == before);
+}
+
+void test_custom_deleter() {
+    atomic<int> deleted{0};
+    for (int i = 0; i < 1000; ++i) {
+        (new counted)->retire(counting_deleter{&deleted}, rcu_default_domain());
+    }
+
+    rcu_barrier();
+    assert(deleted.load() == 1000);
+}
+
+void test_rcu_retire() {
+    struct not_derived {
+        int* count;
+
+        ~not_derived() {
+            ++*count;
+        }
+    };
+
+    int destroyed = 0;
+    rcu_retire(new not_derived{&destroyed});
+    rcu_retire(new int{1729});
+
+    atomic<int> custom{0};
+    rcu_retire(new int{42}, [&custom](int* const p) {
+        assert(*p == 42);
+        ++custom;
+        delete p;
+    });
+
+    rcu_barrier();
+    assert(destroyed == 1);
+    assert(custom.load() == 1);
+}
+
+void test_reader_delays_reclamation() {
+    atomic<config*> current{new config{1}};
+    atomic<bool> reader_in_section{false};
+    atomic<bool> release_reader{false};
+    atomic<bool> synchronized{false};
+
+    thread reader{[&] {
+        scoped_lock lock{rcu_default_domain()};
+        const config* const p = current.load();
+        reader_in_section.store(true);
+        while (!release_reader.load()) {
+            this_thread::yield();
+        }
+
+        assert(p->value == 1);
+        assert(!synchronized.load());
+    }};
+
+    while (!reader_in_section.load()) {
+        this_thread::yield();
+    }
+
+    config* const old = current.exchange(new config{2});
+    thread writer{[&] {
+        rcu_synchronize();
+        synchronized.store(true);
+    }};
+
+    this_thread::sleep_for(50ms);
+    assert(!synchronized.load()); // the grace period waits for the reader
+    release_reader.store(true);
+
+    writer.join();
+    reader.join();
+    assert(synchronized.load());
+
+    old->retire();
+    current.load()->retire();
+    rcu_barrier();
+}
+
+void test_concurrent_readers() {
+    constexpr int reader_count = 4;
+    constexpr int updates      = 5'000;
+
+    atomic<config*> current{new config{0}};
+    atomic<bool> done{false};
+
+    vector<thread> readers;
+    for (int i = 0; i < reader_count; ++i) {
+        readers.emplace_back([&] {
+            while (!done.load()) {
+                scoped_lock lock{rcu_default_domain()};
+                assert(current.load()->value >= 0);
+            }
+        });
+    }
+
+    for (int i = 1; i <= updates; ++i) {
+        current.exchange(new config{i})->retire();
+        if (i % 1000 == 0) {
+            rcu_synchronize();
+        }
+    }
+
+    done.store(true);
+    for (auto& t : readers) {
+        t.join();
+    }
+
+    current.load()->retire();
+    rcu_barrier();
+    assert(live_configs.load() == 0);
+}
+
+int main() {
+    test_lockable();
+    test_barrier_reclaims_everything();
+    test_custom_deleter();
+    test_rcu_retire();
+    test_reader_delays_reclamation();
+    test_concurrent_readers();
+}
@@ -0,0 +1,288 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#define _MSVC_STL_ALLOCATOR_EXPAND_IN_PLACE 1
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+int live_blocks       = 0;
+int expansions        = 0;
+int failed_expansions = 0;
+
+// Each block reserves room to grow to four times its requested size in place.
+struct alignas(max_align_t) block_header {
+    size_t room_bytes;
+    size_t used_bytes;
+};
+
+constexpr size_t growth_room = 4;
+
+block_header& header_of(void* const ptr) {
+    return static_cast<block_header*>(ptr)[-1];
+}
+
+template <class T>
+struct roomy_allocator {
+    using value_type = T;
+
+    roomy_allocator() = default;
+
+    template <class U>
+    roomy_allocator(const roomy_allocator<U>&) noexcept {}
+
+    T* allocate(const size_t n) {
+        const size_t bytes = n * sizeof(T);
+        const auto header  = static_cast<block_header*>(::operator new(sizeof(block_header) + growth_room * bytes));
+        header->room_bytes = growth_room * bytes;
+        header->used_bytes = bytes;
+        ++live_blocks;
+        return reinterpret_cast<T*>(header + 1);
+    }
+
+    void deallocate(T* const ptr, const size_t n) noexcept {
+        auto& header = header_of(ptr);
+        assert(header.used_bytes == n * sizeof(T)); // deallocated with the expanded size
+        --live_blocks;
+        ::operator delete(&header);
+    }
+
+    template <class U>
+    friend bool operator==(const roomy_allocator&, const roomy_allocator<U>&) noexcept {
+        return true;
+    }
+
+    template <class U>
+    friend bool operator!=(const roomy_allocator&, const roomy_allocator<U>&) noexcept {
+        return false;
+    }
+};
+
+namespace stdext {
+    template <class T>
+    struct allocator_expand_traits<roomy_allocator<T>> {
+        static bool try_expand(
+            roomy_allocator<T>&, T* const ptr, const size_t old_count, const size_t new_count) noexcept {
+            auto& header = header_of(ptr);
+            assert(header.used_bytes == old_count * sizeof(T));
+            assert(new_count > old_count);
+            if (new_count * sizeof(T) > header.room_bytes) {
+                ++failed_expansions;
+                return false;
+            }
+
+            header.used_bytes = new_count * sizeof(T);
+            ++expansions;
+            return true;
+        }
+    };
+} // namespace stdext
+
+void reset_counts() {
+    expansions        = 0;
+    failed_expansions = 0;
+}
+
+void test_vector() {
+    reset_counts();
+    {
+        vector<int, roomy_allocator<int>> v;
+        for (int i = 0; i < 1000; ++i) {
+            v.push_back(i);
+        }
+
+        v.shrink_to_fit(); // room for 4000 elements
+        const int* const data = v.data();
+        for (int i = 1000; i < 2000; ++i) {
+            v.push_back(i);
+        }
+
+        v.emplace(v.begin(), -1);
+        v.insert(v.begin() + 11, 1000, -2);
+        assert(v.size() == 3001);
+        assert(v.data() == data); // never moved
+        assert(expansions == 3);
+        assert(failed_expansions == 0);
+
+        v.resize(v.capacity() + 1, -3); // doesn't fit in the room left
+        assert(v.data() != data);
+        assert(failed_expansions == 1);
+
+        assert(v[0] == -1);
+        for (int i = 0; i < 10; ++i) {
+            assert(v[static_cast<size_t>(i) + 1] == i);
+        }
+
+        for (size_t i = 11; i < 1011; ++i) {
+            assert(v[i] == -2);
+        }
+
+        for (int i = 10; i < 2000; ++i) {
+            assert(v[static_cast<size_t>(i) + 1001] == i);
+        }
+
+        assert(v.back() == -3);
+    }
+
+    {
+        vector<int, roomy_allocator<int>> v(100, 7);
+        const int* const data = v.data();
+        v.reserve(300);
+        assert(v.data() == data);
+        assert(v.capacity() == 300);
+        assert(v.size() == 100 && v[99] == 7);
+
+        v.insert(v.end(), {1, 2, 3});
+        v.resize(200);
+        assert(v.data() == data);
+        assert(v.size() == 200 && v[100] == 1 && v[102] == 3 && v[199] == 0);
+    }
+
+    {
+        vector<bool, roomy_allocator<bool>> v;
+        for (int i = 0; i < 100'000; ++i) {
+            v.push_back(i % 3 == 0);
+        }
+
+        assert(expansions > 3);
+        for (int i = 0; i < 100'000; ++i) {
+            assert(v[static_cast<size_t>(i)] == (i % 3 == 0));
+        }
+    }
+
+    assert(live_blocks == 0);
+}
+
+void test_string() {
+    using roomy_string = basic_string<char, char_traits<char>, roomy_allocator<char>>;
+
+    reset_counts();
+    {
+        roomy_string s(1000, 'x'); // room for about 4000 characters
+        const char* const data = s.c_str();
+        for (int i = 0; i < 1000; ++i) {
+            s.push_back('y');
+        }
+
+        s.append(500, 'z');
+        s.append("abc");
+        assert(s.c_str() == data);
+        assert(expansions > 0);
+        assert(failed_expansions == 0);
+
+        assert(s.size() == 2503);
+        assert(s.substr(0, 1000) == roomy_string(1000, 'x'));
+        assert(s.substr(1000, 1000) == roomy_string(1000, 'y'));
+        assert(s.substr(2000, 500) == roomy_string(500, 'z'));
+        assert(s.substr(2500) == "abc");
+        assert(s.c_str()[s.size()] == '\0');
+
+        s.append(3000, 'w'); // doesn't fit in the room left
+        assert(s.c_str() != data);
+        assert(failed_expansions == 1);
+        assert(s.size() == 5503 && s[2502] == 'c' && s.back() == 'w');
+    }
+
+    {
+        basic_string<wchar_t, char_traits<wchar_t>, roomy_allocator<wchar_t>> s(L"short");
+        for (int i = 0; i < 100; ++i) {
+            s += L"0123456789";
+        }
+
+        assert(s.size() == 1005 && s.substr(0, 5) == L"short" && s.back() == L'9');
+    }
+
+    assert(live_blocks == 0);
+}
+
+void test_deque() {
+    reset_counts();
+    {
+        deque<int, roomy_allocator<int>> d;
+        deque<int> expected;
+        for (int i = 0; i < 20'000; ++i) { // grows the block map many times, with blocks wrapped around the map
+            if (i % 3 == 0) {
+                d.push_front(i);
+                expected.push_front(i);
+            } else {
+                d.push_back(i);
+                expected.push_back(i);
+            }
+
+            if (i % 1000 == 999) {
+                for (int j = 0; j < 100; ++j) {
+                    d.pop_front();
+                    expected.pop_front();
+                }
+            }
+        }
+
+        assert(expansions > 0);
+        assert(d.size() == expected.size());
+        for (size_t i = 0; i < d.size(); ++i) {
+            assert(d[i] == expected[i]);
+        }
+    }
+
+    assert(live_blocks == 0);
+}
+
+void test_std_allocator() {
+    // std::allocator tries the CRT's _expand(), which may or may not succeed
+    vector<int> v;
+    for (int i = 0; i < 1'000'000; ++i) {
+        v.push_back(i);
+    }
+
+    for (int i = 0; i < 1'000'000; ++i) {
+        assert(v[static_cast<size_t>(i)] == i);
+    }
+
+    vector<int> small{1, 2, 3};
+    small.reserve(2000); // becomes a manually aligned big allocation, so it has to move
+    small.reserve(100'000);
+    assert(small.size() == 3 && small[2] == 3);
+
+    struct alignas(64) over_aligned {
+        int value;
+    };
+
+    vector<over_aligned> aligned;
+    for (int i = 0; i < 10'000; ++i) {
+        aligned.push_back({i});
+    }
+
+    for (int i = 0; i < 10'000; ++i) {
+        assert(aligned[static_cast<size_t>(i)].value == i);
+        assert(reinterpret_cast<uintptr_t>(&aligned[static_cast<size_t>(i)]) % 64 == 0);
+    }
+
+    string s(100, 'a');
+    for (int i = 0; i < 100'000; ++i) {
+        s.push_back(static_cast<char>('a' + i % 26));
+    }
+
+    assert(s.size() == 100'100 && s[99] == 'a' && s[100] == 'a' && s[101] == 'b' && s.back() == 'a' + 99'999 % 26);
+
+    deque<int> d;
+    for (int i = 0; i < 1'000'000; ++i) {
+        d.push_back(i);
+    }
+
+    assert(d.front() == 0 && d.back() == 999'999);
+}
+
+int main() {
+    test_vector();
+    test_string();
+    test_deque();
+    test_std_allocator();
+}
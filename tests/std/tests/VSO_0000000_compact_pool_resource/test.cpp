@@ -0,0 +1,181 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <memory_resource>
+#include <vector>
+
+using namespace std;
+
+class counting_resource : public pmr::memory_resource {
+public:
+    size_t live_bytes        = 0;
+    size_t live_allocations  = 0;
+    size_t total_allocations = 0;
+
+private:
+    void* do_allocate(const size_t bytes, const size_t align) override {
+        void* const ptr = pmr::new_delete_resource()->allocate(bytes, align);
+        live_bytes += bytes;
+        ++live_allocations;
+        ++total_allocations;
+        return ptr;
+    }
+
+    void do_deallocate(void* const ptr, const size_t bytes, const size_t align) override {
+        assert(live_bytes >= bytes);
+        assert(live_allocations != 0);
+        live_bytes -= bytes;
+        --live_allocations;
+        pmr::new_delete_resource()->deallocate(ptr, bytes, align);
+    }
+
+    bool do_is_equal(const pmr::memory_resource& that) const noexcept override {
+        return this == &that;
+    }
+};
+
+struct block {
+    unsigned char* ptr;
+    size_t size;
+    size_t align;
+};
+
+void test_size_classes() {
+    // blocks of every small size and alignment are distinct, aligned, and don't overlap
+    counting_resource upstream;
+    {
+        stdext::pmr::compact_pool_resource res{pmr::pool_options{3, 1024}, &upstream};
+        vector<block> blocks;
+        for (size_t size = 1; size <= 600; ++size) {
+            for (size_t align = 1; align <= 64; align <<= 1) {
+                const auto ptr = static_cast<unsigned char*>(res.allocate(size, align));
+                assert(reinterpret_cast<uintptr_t>(ptr) % align == 0);
+                memset(ptr, static_cast<unsigned char>(blocks.size()), size);
+                blocks.push_back({ptr, size, align});
+            }
+        }
+
+        for (size_t i = 0; i < blocks.size(); ++i) {
+            const auto& b = blocks[i];
+            assert(all_of(
+                b.ptr, b.ptr + b.size, [i](const unsigned char c) { return c == static_cast<unsigned char>(i); }));
+        }
+
+        // deallocate in an order that doesn't match allocation order
+        for (size_t i = 0; i < blocks.size(); i += 2) {
+            res.deallocate(blocks[i].ptr, blocks[i].size, blocks[i].align);
+        }
+        for (size_t i = blocks.size() - 1; i < blocks.size(); i -= 2) {
+            res.deallocate(blocks[i].ptr, blocks[i].size, blocks[i].align);
+        }
+    }
+
+    assert(upstream.live_bytes == 0);
+    assert(upstream.live_allocations == 0);
+}
+
+void test_footprint() {
+    // 24-byte list nodes aren't rounded up to 32 bytes or more, and carry no footer
+    counting_resource upstream;
+    stdext::pmr::compact_pool_resource res{&upstream};
+    constexpr size_t n = (size_t{1} << 14) - 4; // exactly fills chunks of 4, 8, 16, ..., 8192 blocks
+    for (size_t i = 0; i < n; ++i) {
+        (void) res.allocate(24, 8);
+    }
+
+    assert(upstream.live_bytes < n * 25);
+    res.release();
+    assert(upstream.live_bytes == 0);
+}
+
+void test_reuse() {
+    // freed blocks are reused before any new chunk is requested, whatever order they're freed in
+    counting_resource upstream;
+    stdext::pmr::compact_pool_resource res{&upstream};
+    vector<void*> ptrs;
+    for (int i = 0; i < 1000; ++i) {
+        ptrs.push_back(res.allocate(40, 8));
+    }
+
+    const size_t allocations = upstream.total_allocations;
+    for (size_t i = 0; i < ptrs.size(); ++i) {
+        res.deallocate(ptrs[(i * 389) % ptrs.size()], 40, 8);
+    }
+
+    vector<void*> again;
+    for (int i = 0; i < 1000; ++i) {
+        again.push_back(res.allocate(33 + static_cast<size_t>(i % 8), 8)); // same size class as 40
+    }
+
+    assert(upstream.total_allocations == allocations);
+    sort(ptrs.begin(), ptrs.end());
+    sort(again.begin(), again.end());
+    assert(ptrs == again);
+}
+
+void test_options_and_oversized() {
+    counting_resource upstream;
+    {
+        stdext::pmr::compact_pool_resource res{pmr::pool_options{0, 1000}, &upstream};
+        assert(res.upstream_resource() == &upstream);
+        assert(res.options().largest_required_pool_block == 1024); // rounded up to a size class
+        assert(res.options().max_blocks_per_chunk != 0);
+
+        void* const small = res.allocate(1024, 1024);
+        assert(reinterpret_cast<uintptr_t>(small) % 1024 == 0);
+        const size_t live_allocations = upstream.live_allocations;
+
+        void* const large = res.allocate(5000, 64);
+        assert(reinterpret_cast<uintptr_t>(large) % 64 == 0);
+        assert(upstream.live_allocations == live_allocations + 1);
+        res.deallocate(large, 5000, 64);
+        assert(upstream.live_allocations == live_allocations);
+
+        (void) res.allocate(100'000); // left to the destructor
+    }
+
+    assert(upstream.live_bytes == 0);
+    assert(upstream.live_allocations == 0);
+}
+
+void test_pmr_containers() {
+    counting_resource upstream;
+    {
+        stdext::pmr::compact_pool_resource res{&upstream};
+        pmr::list<int> lst{&res};
+        for (int i = 0; i < 10'000; ++i) {
+            lst.push_back(i);
+        }
+
+        lst.remove_if([](const int x) { return x % 3 == 0; });
+        for (int i = 0; i < 1'000; ++i) {
+            lst.push_front(-i);
+        }
+
+        pmr::vector<pmr::vector<int>> nested{&res};
+        for (int i = 0; i < 1'000; ++i) {
+            nested.emplace_back(static_cast<size_t>(i % 50), i);
+        }
+
+        for (size_t i = 0; i < nested.size(); ++i) {
+            assert(all_of(nested[i].begin(), nested[i].end(), [i](const int x) { return x == static_cast<int>(i); }));
+        }
+    }
+
+    assert(upstream.live_bytes == 0);
+    assert(upstream.live_allocations == 0);
+}
+
+int main() {
+    test_size_classes();
+    test_footprint();
+    test_reuse();
+    test_options_and_oversized();
+    test_pmr_containers();
+}
@@ -0,0 +1,176 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#define _MSVC_STL_DEQUE_BLOCK_BYTES 1024
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+template <class T>
+constexpr int block_size = _Deque_val<_Deque_simple_types<T>>::_Block_size;
+
+template <class T>
+constexpr bool is_smallest_filling_block() {
+    // a power of 2 number of elements, the fewest that take up at least 1024 bytes
+    return (block_size<T> & (block_size<T> - 1)) == 0 && block_size<T> * sizeof(T) >= 1024
+        && (block_size<T> == 1 || block_size<T> / 2 * sizeof(T) < 1024);
+}
+
+struct big {
+    char bytes[3000];
+};
+
+STATIC_ASSERT(block_size<char> == 1024);
+STATIC_ASSERT(block_size<int> == 256);
+STATIC_ASSERT(block_size<double> == 128);
+STATIC_ASSERT(block_size<big> == 1);
+STATIC_ASSERT(is_smallest_filling_block<string>());
+STATIC_ASSERT(is_smallest_filling_block<vector<int>>());
+STATIC_ASSERT(is_smallest_filling_block<big>());
+
+size_t block_allocations = 0;
+
+template <class T>
+struct counting_allocator {
+    using value_type = T;
+
+    counting_allocator() = default;
+
+    template <class U>
+    counting_allocator(const counting_allocator<U>&) noexcept {}
+
+    T* allocate(const size_t n) {
+        if (is_same<T, string>::value && n == static_cast<size_t>(block_size<T>)) {
+            ++block_allocations;
+        }
+
+        return allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* const ptr, const size_t n) noexcept {
+        allocator<T>{}.deallocate(ptr, n);
+    }
+
+    template <class U>
+    friend bool operator==(const counting_allocator&, const counting_allocator<U>&) noexcept {
+        return true;
+    }
+
+    template <class U>
+    friend bool operator!=(const counting_allocator&, const counting_allocator<U>&) noexcept {
+        return false;
+    }
+};
+
+void test_block_allocations() {
+    deque<string, counting_allocator<string>> d;
+    for (int i = 0; i < 1000; ++i) {
+        d.push_back(to_string(i));
+    }
+
+    const size_t blocks_needed = (1000 + block_size<string> - 1) / block_size<string>;
+    assert(block_allocations >= blocks_needed && block_allocations <= blocks_needed + 1);
+
+    for (int i = 0; i < 1000; ++i) {
+        assert(d[static_cast<size_t>(i)] == to_string(i));
+    }
+}
+
+template <class T>
+void test_against_vector(T (*make)(int), const int operations) {
+    deque<T> d;
+    vector<T> expected;
+    for (int i = 0; i < operations; ++i) {
+        switch (i % 7) {
+        case 0:
+        case 1:
+            d.push_front(make(i));
+            expected.insert(expected.begin(), make(i));
+            break;
+        case 2:
+        case 3:
+        case 4:
+            d.push_back(make(i));
+            expected.push_back(make(i));
+            break;
+        case 5:
+            d.insert(d.begin() + static_cast<ptrdiff_t>(d.size() / 3), make(i));
+            expected.insert(expected.begin() + static_cast<ptrdiff_t>(expected.size() / 3), make(i));
+            break;
+        default:
+            if (i % 100 == 6) {
+                const auto n = static_cast<ptrdiff_t>(min(d.size(), size_t{300}));
+                d.erase(d.begin() + 1, d.begin() + n);
+                expected.erase(expected.begin() + 1, expected.begin() + n);
+            } else {
+                d.pop_back();
+                expected.pop_back();
+            }
+            break;
+        }
+    }
+
+    assert(equal(d.begin(), d.end(), expected.begin(), expected.end()));
+    assert(equal(d.rbegin(), d.rend(), expected.rbegin(), expected.rend()));
+    for (size_t i = 0; i < d.size(); i += 37) {
+        assert(d[i] == expected[i]);
+        assert(*(d.begin() + static_cast<ptrdiff_t>(i)) == expected[i]);
+        assert(d.end() - (d.begin() + static_cast<ptrdiff_t>(i)) == static_cast<ptrdiff_t>(d.size() - i));
+    }
+
+    d.shrink_to_fit();
+    assert(equal(d.begin(), d.end(), expected.begin(), expected.end()));
+
+    d.resize(10);
+    d.shrink_to_fit();
+    assert(equal(d.begin(), d.end(), expected.begin(), expected.begin() + 10));
+
+    deque<T> copy(d);
+    assert(copy == d);
+    d.clear();
+    assert(d.empty() && copy.size() == 10);
+}
+
+char make_char(const int i) {
+    return static_cast<char>(i);
+}
+
+int make_int(const int i) {
+    return i;
+}
+
+string make_string(const int i) {
+    return to_string(i);
+}
+
+big make_big(const int i) {
+    big result{};
+    result.bytes[0] = static_cast<char>(i);
+    return result;
+}
+
+bool operator==(const big& left, const big& right) {
+    return equal(begin(left.bytes), end(left.bytes), begin(right.bytes));
+}
+
+bool operator!=(const big& left, const big& right) {
+    return !(left == right);
+}
+
+int main() {
+    test_block_allocations();
+    test_against_vector(make_char, 5000);
+    test_against_vector(make_int, 5000);
+    test_against_vector(make_string, 5000);
+    test_against_vector(make_big, 500);
+}
@@ -0,0 +1,131 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <vector>
+
+using namespace std;
+
+constexpr int samples = 100'000;
+
+// chi-squared critical values for p = 0.001, indexed by degrees of freedom
+constexpr double critical_values[] = {
+    0.0, 10.828, 13.816, 16.266, 18.467, 20.515, 22.458, 24.322, 26.124, 27.877, 29.588, 31.264, 32.909, 34.528};
+
+void test_frequencies(const vector<double>& weights) {
+    discrete_distribution<int> dist(weights.begin(), weights.end());
+    const vector<double> probabilities = dist.probabilities();
+    assert(probabilities.size() == weights.size());
+
+    mt19937 eng;
+    vector<int> frequency(weights.size());
+    for (int i = 0; i < samples; ++i) {
+        const int val = dist(eng);
+        assert(val >= (dist.min)() && val <= (dist.max)());
+        assert(probabilities[static_cast<size_t>(val)] > 0.0);
+        ++frequency[static_cast<size_t>(val)];
+    }
+
+    double chi_squared = 0.0;
+    int degrees        = -1;
+    for (size_t i = 0; i < weights.size(); ++i) {
+        if (probabilities[i] > 0.0) {
+            const double expected = probabilities[i] * samples;
+            const double delta    = frequency[i] - expected;
+            chi_squared += delta * delta / expected;
+            ++degrees;
+        }
+    }
+
+    assert(chi_squared <= critical_values[degrees]);
+}
+
+void test_large_table() {
+    // 100'000 categories, where the first 1'000 are 100 times as likely as the rest
+    vector<double> weights;
+    for (int i = 0; i < 100'000; ++i) {
+        weights.push_back(i < 1'000 ? 100.0 : 1.0);
+    }
+
+    discrete_distribution<int> dist(weights.begin(), weights.end());
+    minstd_rand eng;
+    int frequency[2] = {};
+    for (int i = 0; i < samples; ++i) {
+        ++frequency[dist(eng) < 1'000 ? 0 : 1];
+    }
+
+    // 100'000 / 199'000 of the mass is on the first 1'000 categories
+    const double expected[2] = {samples * (100'000.0 / 199'000.0), samples * (99'000.0 / 199'000.0)};
+    double chi_squared       = 0.0;
+    for (int i = 0; i < 2; ++i) {
+        const double delta = frequency[i] - expected[i];
+        chi_squared += delta * delta / expected[i];
+    }
+
+    assert(chi_squared <= critical_values[1]);
+}
+
+void test_interface_unchanged() {
+    discrete_distribution<short> dist{1.0, 0.0, 3.0, 4.0};
+    const vector<double> expected = {0.125, 0.0, 0.375, 0.5};
+    assert(dist.probabilities() == expected);
+    assert(dist.param().probabilities() == expected);
+    assert((dist.min)() == 0 && (dist.max)() == 3);
+
+    // streaming round-trips the probabilities and reproduces the same samples
+    stringstream ss;
+    ss << dist;
+    discrete_distribution<short> read_back;
+    ss >> read_back;
+    assert(read_back == dist);
+    assert(read_back.probabilities() == expected);
+
+    mt19937_64 eng1;
+    mt19937_64 eng2;
+    for (int i = 0; i < 1'000; ++i) {
+        assert(dist(eng1) == read_back(eng2));
+    }
+
+    // param_type keeps working as an argument
+    const discrete_distribution<short>::param_type par{0.0, 0.0, 1.0};
+    for (int i = 0; i < 100; ++i) {
+        assert(dist(eng1, par) == 2);
+    }
+
+    dist.param(par);
+    assert(dist.param() == par);
+    assert((dist.max)() == 2);
+
+    discrete_distribution<int> degenerate;
+    assert(degenerate.probabilities() == vector<double>{1.0});
+    for (int i = 0; i < 100; ++i) {
+        assert(degenerate(eng1) == 0);
+    }
+
+    // piecewise distributions build on discrete_distribution<size_t>
+    const double bounds[]    = {0.0, 1.0, 2.0, 4.0};
+    const double densities[] = {1.0, 0.0, 0.5};
+    piecewise_constant_distribution<double> constant(begin(bounds), end(bounds), begin(densities));
+    piecewise_linear_distribution<double> linear(begin(bounds), end(bounds), begin(bounds));
+    for (int i = 0; i < 1'000; ++i) {
+        const double x = constant(eng1);
+        assert((0.0 <= x && x < 1.0) || (2.0 <= x && x < 4.0));
+        const double y = linear(eng1);
+        assert(0.0 <= y && y <= 4.0);
+    }
+}
+
+int main() {
+    test_frequencies({1.0});
+    test_frequencies({1.0, 1.0});
+    test_frequencies({1.0, 2.0, 3.0, 4.0, 5.0});
+    test_frequencies({0.0, 5.0, 0.0, 1.0, 0.0});
+    test_frequencies({1000.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0});
+    test_frequencies({1.0, 1.0, 2.0, 4.0, 8.0, 16.0, 32.0, 64.0, 128.0, 256.0, 512.0, 1024.0, 2048.0, 4096.0});
+    test_large_table();
+    test_interface_unchanged();
+}
@@ -0,0 +1,190 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+using stdext::distributed_shared_mutex;
+
+static_assert(!is_copy_constructible_v<distributed_shared_mutex>);
+static_assert(!is_copy_assignable_v<distributed_shared_mutex>);
+static_assert(is_nothrow_destructible_v<distributed_shared_mutex>);
+static_assert(noexcept(declval<distributed_shared_mutex&>().lock()));
+static_assert(noexcept(declval<distributed_shared_mutex&>().lock_shared()));
+
+void test_single_thread() {
+    distributed_shared_mutex mtx;
+
+    mtx.lock();
+    mtx.unlock();
+
+    mtx.lock_shared();
+    mtx.lock_shared(); // shared ownership is not exclusive, even within a thread
+    assert(mtx.try_lock_shared());
+    mtx.unlock_shared();
+    mtx.unlock_shared();
+    mtx.unlock_shared();
+
+    assert(mtx.try_lock());
+    mtx.unlock();
+
+    {
+        shared_lock lock{mtx};
+        assert(lock.owns_lock());
+    }
+
+    {
+        unique_lock lock{mtx};
+        assert(lock.owns_lock());
+    }
+
+    {
+        scoped_lock lock{mtx};
+    }
+}
+
+void test_exclusion() {
+    distributed_shared_mutex mtx;
+
+    mtx.lock();
+    thread{[&] {
+        assert(!mtx.try_lock());
+        assert(!mtx.try_lock_shared());
+    }}.join();
+    mtx.unlock();
+
+    mtx.lock_shared();
+    thread{[&] {
+        assert(!mtx.try_lock());
+        assert(mtx.try_lock_shared()); // readers share
+        mtx.unlock_shared();
+    }}.join();
+    mtx.unlock_shared();
+
+    thread{[&] {
+        assert(mtx.try_lock());
+        mtx.unlock();
+    }}.join();
+}
+
+void test_writer_waits_for_readers() {
+    distributed_shared_mutex mtx;
+    atomic<bool> writer_done{false};
+
+    mtx.lock_shared();
+    thread writer{[&] {
+        mtx.lock();
+        writer_done.store(true);
+        mtx.unlock();
+    }};
+
+    this_thread::sleep_for(50ms);
+    assert(!writer_done.load());
+    mtx.unlock_shared();
+    writer.join();
+    assert(writer_done.load());
+}
+
+void test_writer_preference() {
+    distributed_shared_mutex mtx;
+    atomic<bool> writer_done{false};
+    atomic<bool> late_reader_done{false};
+
+    mtx.lock_shared();
+    thread writer{[&] {
+        mtx.lock();
+        assert(!late_reader_done.load());
+        writer_done.store(true);
+        mtx.unlock();
+    }};
+
+    // once the writer is waiting for us, new shared ownership is refused
+    while (mtx.try_lock_shared()) {
+        mtx.unlock_shared();
+        this_thread::yield();
+    }
+
+    thread late_reader{[&] {
+        mtx.lock_shared(); // waits behind the writer
+        assert(writer_done.load());
+        late_reader_done.store(true);
+        mtx.unlock_shared();
+    }};
+
+    this_thread::sleep_for(50ms);
+    assert(!late_reader_done.load());
+    mtx.unlock_shared();
+
+    writer.join();
+    late_reader.join();
+}
+
+void test_std_lock() {
+    distributed_shared_mutex first;
+    distributed_shared_mutex second;
+
+    vector<thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&, i] {
+            for (int j = 0; j < 1000; ++j) {
+                if (i % 2 == 0) {
+                    lock(first, second);
+                } else {
+                    lock(second, first);
+                }
+
+                first.unlock();
+                second.unlock();
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+}
+
+void test_mixed_stress() {
+    distributed_shared_mutex mtx;
+    long long protected_a = 0;
+    long long protected_b = 0;
+
+    vector<thread> threads;
+    for (int i = 0; i < 6; ++i) {
+        threads.emplace_back([&, i] {
+            for (int j = 0; j < 5000; ++j) {
+                if (i == 0 && j % 10 == 0) {
+                    scoped_lock lock{mtx};
+                    ++protected_a;
+                    ++protected_b;
+                } else {
+                    shared_lock lock{mtx};
+                    assert(protected_a == protected_b);
+                }
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    assert(protected_a == 500);
+    assert(protected_b == 500);
+}
+
+int main() {
+    test_single_thread();
+    test_exclusion();
+    test_writer_waits_for_readers();
+    test_writer_preference();
+    test_std_lock();
+    test_mixed_stress();
+}
@@ -0,0 +1,269 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <istream>
+#include <locale>
+#include <memory>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <utility>
+
+using namespace std;
+
+// getline and operator>> consume the get area a span at a time; these stream buffers make the spans short, or
+// provide no get area at all, so that lines and words straddle refills.
+template <class CharT>
+class chunked_buf : public basic_streambuf<CharT> {
+public:
+    using int_type = typename basic_streambuf<CharT>::int_type;
+
+    chunked_buf(basic_string<CharT> str, size_t chunk) : contents(move(str)), chunk_size(chunk) {}
+
+    int underflow_calls = 0;
+
+protected:
+    int_type underflow() override {
+        ++underflow_calls;
+        if (pos == contents.size()) {
+            return char_traits<CharT>::eof();
+        }
+
+        const auto first = &contents[pos];
+        if (chunk_size == 0) { // unbuffered, see uflow
+            return char_traits<CharT>::to_int_type(*first);
+        }
+
+        const size_t count = (min) (chunk_size, contents.size() - pos);
+        this->setg(first, first, first + count);
+        pos += count;
+        return char_traits<CharT>::to_int_type(*first);
+    }
+
+    int_type uflow() override {
+        if (chunk_size != 0) {
+            return basic_streambuf<CharT>::uflow();
+        }
+
+        if (pos == contents.size()) {
+            return char_traits<CharT>::eof();
+        }
+
+        return char_traits<CharT>::to_int_type(contents[pos++]);
+    }
+
+private:
+    basic_string<CharT> contents;
+    size_t pos = 0;
+    size_t chunk_size;
+};
+
+template <class CharT>
+basic_string<CharT> widen(const char* const str) {
+    basic_string<CharT> result;
+    for (auto p = str; *p != '\0'; ++p) {
+        result.push_back(static_cast<CharT>(*p));
+    }
+
+    return result;
+}
+
+template <class CharT>
+void test_getline(const size_t chunk) {
+    chunked_buf<CharT> buf{widen<CharT>("first line\n\nthird, a longer line than the others\nunterminated"), chunk};
+    basic_istream<CharT> is{&buf};
+    basic_string<CharT> line = widen<CharT>("stale");
+
+    assert(getline(is, line));
+    assert(line == widen<CharT>("first line"));
+    assert(getline(is, line));
+    assert(line.empty());
+    assert(getline(is, line));
+    assert(line == widen<CharT>("third, a longer line than the others"));
+    assert(getline(is, line));
+    assert(line == widen<CharT>("unterminated"));
+    assert(is.eof());
+    assert(!is.fail());
+
+    assert(!getline(is, line));
+}
+
+template <class CharT>
+void test_getline_delimiter(const size_t chunk) {
+    chunked_buf<CharT> buf{widen<CharT>("a,bb,,ccc,"), chunk};
+    basic_istream<CharT> is{&buf};
+    basic_string<CharT> field;
+
+    assert(getline(is, field, CharT{','}) && field == widen<CharT>("a"));
+    assert(getline(is, field, CharT{','}) && field == widen<CharT>("bb"));
+    assert(getline(is, field, CharT{','}) && field.empty());
+    assert(getline(is, field, CharT{','}) && field == widen<CharT>("ccc"));
+    assert(!is.eof()); // the last delimiter was consumed without looking further
+    assert(!getline(is, field, CharT{','}));
+    assert(is.eof());
+}
+
+template <class T>
+struct tiny_allocator {
+    using value_type = T;
+
+    tiny_allocator() = default;
+    template <class U>
+    tiny_allocator(const tiny_allocator<U>&) {}
+
+    T* allocate(const size_t n) {
+        return allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* const p, const size_t n) {
+        allocator<T>{}.deallocate(p, n);
+    }
+
+    size_t max_size() const noexcept {
+        return 40;
+    }
+
+    template <class U>
+    bool operator==(const tiny_allocator<U>&) const noexcept {
+        return true;
+    }
+    template <class U>
+    bool operator!=(const tiny_allocator<U>&) const noexcept {
+        return false;
+    }
+};
+
+void test_getline_max_size(const size_t chunk) {
+    using tiny_string = basic_string<char, char_traits<char>, tiny_allocator<char>>;
+    const size_t max  = tiny_string{}.max_size();
+    assert(max < 100);
+
+    chunked_buf<char> buf{"short\n" + string(max + 5, 'z') + "\nyy", chunk};
+    istream is{&buf};
+    tiny_string line;
+
+    assert(getline(is, line) && line == "short");
+
+    assert(!getline(is, line)); // stops at max_size(), leaving the rest of the line unread
+    assert(line == tiny_string(max, 'z'));
+    assert(!is.eof());
+    is.clear();
+
+    assert(getline(is, line) && line == "zzzzz");
+    assert(getline(is, line) && line == "yy");
+    assert(is.eof());
+
+    chunked_buf<char> exact_buf{string(max, 'w') + "\nv", chunk};
+    istream exact{&exact_buf};
+    assert(getline(exact, line) && line == tiny_string(max, 'w')); // a delimiter right after a full string is fine
+    assert(getline(exact, line) && line == "v");
+}
+
+template <class CharT>
+void test_extraction(const size_t chunk) {
+    chunked_buf<CharT> buf{widen<CharT>("  alpha beta\t\tgamma-delta\nepsilon   "), chunk};
+    basic_istream<CharT> is{&buf};
+    basic_string<CharT> word;
+
+    assert(is >> word && word == widen<CharT>("alpha"));
+    assert(is >> word && word == widen<CharT>("beta"));
+    is.width(5);
+    assert(is >> word && word == widen<CharT>("gamma"));
+    assert(is.width() == 0);
+    assert(is >> word && word == widen<CharT>("-delta"));
+    assert(is >> word && word == widen<CharT>("epsilon"));
+    assert(!is.eof()); // stopped at whitespace
+    assert(!(is >> word));
+    assert(is.eof());
+}
+
+void test_width_does_not_read_ahead() {
+    chunked_buf<char> buf{"abcdef", 3};
+    istream is{&buf};
+    string word;
+
+    is.width(3);
+    assert(is >> word && word == "abc");
+    assert(buf.underflow_calls == 1); // the next chunk isn't needed yet
+    assert(is >> word && word == "def");
+}
+
+// A user ctype facet may override do_is alone; extraction must still classify each character through is().
+struct comma_space_ctype : ctype<wchar_t> {
+    using ctype<wchar_t>::do_is;
+
+    bool do_is(const mask m, const wchar_t c) const override {
+        if (c == L',') {
+            return (m & space) != 0;
+        }
+
+        return ctype<wchar_t>::do_is(m, c);
+    }
+};
+
+void test_user_ctype_do_is() {
+    wistringstream words{L"ab,cd ef"};
+    words.imbue(locale{locale::classic(), new comma_space_ctype});
+    wstring word;
+
+    assert(words >> word && word == L"ab");
+    assert(words >> word && word == L"cd");
+    assert(words >> word && word == L"ef");
+    assert(!(words >> word));
+}
+
+void test_stringstream() {
+    string contents;
+    for (int i = 0; i < 1000; ++i) {
+        contents += to_string(i);
+        contents += i % 3 == 0 ? '\n' : ' ';
+    }
+
+    istringstream lines{contents};
+    string line;
+    int line_count = 0;
+    while (getline(lines, line)) {
+        ++line_count;
+    }
+
+    assert(line_count == 334);
+
+    istringstream words{contents};
+    string word;
+    for (int i = 0; i < 1000; ++i) {
+        assert(words >> word);
+        assert(word == to_string(i));
+    }
+
+    assert(!(words >> word));
+}
+
+template <class CharT>
+void test_all() {
+    for (size_t chunk = 0; chunk < 8; ++chunk) {
+        test_getline<CharT>(chunk);
+        test_getline_delimiter<CharT>(chunk);
+        test_extraction<CharT>(chunk);
+    }
+
+    test_getline<CharT>(1000);
+    test_getline_delimiter<CharT>(1000);
+    test_extraction<CharT>(1000);
+}
+
+int main() {
+    test_all<char>();
+    test_all<wchar_t>();
+
+    for (size_t chunk = 0; chunk < 8; ++chunk) {
+        test_getline_max_size(chunk);
+    }
+
+    test_getline_max_size(1000);
+    test_width_does_not_read_ahead();
+    test_user_ctype_do_is();
+    test_stringstream();
+}
@@ -0,0 +1,255 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <charconv>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <istream>
+#include <iterator>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+using namespace std;
+namespace fs = std::filesystem;
+using stdext::mapped_filebuf;
+
+static_assert(is_base_of_v<streambuf, mapped_filebuf>);
+static_assert(!is_copy_constructible_v<mapped_filebuf>);
+static_assert(!is_copy_assignable_v<mapped_filebuf>);
+
+const fs::path test_file{L"mapped_filebuf_test.dat"};
+
+// The smallest window that can be requested is 64 KiB; line_count lines span several of them.
+constexpr streamsize small_window = 1;
+constexpr size_t window_bytes     = 64 * 1024;
+constexpr int line_count          = 30'000;
+
+void write_file(const string& contents) {
+    ofstream out{test_file, ios::binary | ios::trunc};
+    out.write(contents.data(), static_cast<streamsize>(contents.size()));
+    assert(out);
+}
+
+string make_lines() {
+    string contents;
+    for (int i = 0; i < line_count; ++i) {
+        contents += "line ";
+        contents += to_string(i);
+        contents += '\n';
+    }
+
+    assert(contents.size() > 3 * window_bytes);
+    return contents;
+}
+
+void test_open_close() {
+    mapped_filebuf buf;
+    assert(!buf.is_open());
+    assert(buf.close() == nullptr);
+    assert(buf.open(L"mapped_filebuf_test_does_not_exist.dat") == nullptr);
+    assert(!buf.is_open());
+
+    write_file("meow");
+    assert(buf.open(test_file) == &buf);
+    assert(buf.is_open());
+    assert(buf.open(test_file) == nullptr); // already open
+    assert(buf.close() == &buf);
+    assert(!buf.is_open());
+    assert(buf.sgetc() == char_traits<char>::eof());
+
+    assert(buf.open(test_file.wstring()) == &buf);
+    assert(buf.sbumpc() == 'm');
+}
+
+void test_empty_file() {
+    write_file("");
+    mapped_filebuf buf;
+    assert(buf.open(test_file) == &buf);
+    assert(buf.sgetc() == char_traits<char>::eof());
+    assert(buf.in_avail() == -1);
+    assert(buf.view().empty());
+    assert(buf.pubseekoff(0, ios::end, ios::in) == 0);
+    assert(buf.pubseekoff(1, ios::beg, ios::in) == -1);
+}
+
+void test_extraction() {
+    write_file("12 34 hello\nsecond line\nno newline at end");
+    mapped_filebuf buf;
+    assert(buf.open(test_file));
+    istream in{&buf};
+
+    int first  = 0;
+    int second = 0;
+    string word;
+    assert(in >> first >> second >> word);
+    assert(first == 12 && second == 34 && word == "hello");
+
+    string line;
+    assert(getline(in, line) && line.empty());
+    assert(getline(in, line) && line == "second line");
+    assert(getline(in, line) && line == "no newline at end");
+    assert(in.eof());
+    assert(!getline(in, line));
+}
+
+void test_lines_across_windows() {
+    const string contents = make_lines();
+    write_file(contents);
+
+    {
+        mapped_filebuf buf;
+        assert(buf.pubsetbuf(nullptr, small_window) == &buf);
+        assert(buf.open(test_file));
+        istream in{&buf};
+        string line;
+        int count = 0;
+        while (getline(in, line)) {
+            assert(line == "line " + to_string(count));
+            ++count;
+        }
+
+        assert(count == line_count);
+    }
+
+    {
+        mapped_filebuf buf;
+        assert(buf.pubsetbuf(nullptr, small_window) == &buf);
+        assert(buf.open(test_file));
+        assert(string(istreambuf_iterator<char>{&buf}, istreambuf_iterator<char>{}) == contents);
+    }
+
+    {
+        mapped_filebuf buf;
+        assert(buf.pubsetbuf(nullptr, small_window) == &buf);
+        assert(buf.open(test_file));
+        string result(contents.size(), '\0');
+        assert(buf.sgetn(result.data(), static_cast<streamsize>(result.size()))
+               == static_cast<streamsize>(contents.size()));
+        assert(result == contents);
+        assert(buf.sgetc() == char_traits<char>::eof());
+    }
+}
+
+void test_seek() {
+    const string contents = make_lines();
+    write_file(contents);
+    const auto size = static_cast<streamoff>(contents.size());
+
+    mapped_filebuf buf;
+    assert(buf.pubsetbuf(nullptr, small_window) == &buf);
+    assert(buf.open(test_file));
+
+    for (const streamoff pos : {streamoff{0}, streamoff{10}, streamoff{window_bytes - 1}, streamoff{window_bytes},
+             streamoff{3 * window_bytes + 5}, size - 1, streamoff{7}}) {
+        assert(buf.pubseekpos(pos, ios::in) == pos);
+        assert(buf.pubseekoff(0, ios::cur, ios::in) == pos);
+        assert(buf.sbumpc() == contents[static_cast<size_t>(pos)]);
+        assert(buf.pubseekoff(0, ios::cur, ios::in) == pos + 1);
+    }
+
+    assert(buf.pubseekoff(-1, ios::end, ios::in) == size - 1);
+    assert(buf.sbumpc() == '\n');
+    assert(buf.sgetc() == char_traits<char>::eof());
+    assert(buf.pubseekoff(0, ios::end, ios::in) == size);
+    assert(buf.pubseekoff(1, ios::end, ios::in) == -1);
+    assert(buf.pubseekoff(-size - 1, ios::end, ios::in) == -1);
+    assert(buf.pubseekoff(0, ios::beg, ios::out) == -1);
+    assert(buf.pubseekoff(-size, ios::end, ios::in) == 0);
+    assert(buf.sgetc() == 'l');
+
+    assert(buf.pubseekpos(window_bytes - 2, ios::in) == window_bytes - 2);
+    assert(buf.pubseekoff(5, ios::cur, ios::in) == window_bytes + 3);
+    assert(buf.sgetc() == contents[window_bytes + 3]);
+    assert(buf.in_avail() > 0);
+
+    istream in{&buf};
+    assert(in.seekg(window_bytes * 2));
+    assert(in.tellg() == streamoff{window_bytes * 2});
+    assert(in.get() == contents[window_bytes * 2]);
+}
+
+void test_putback() {
+    const string contents = make_lines();
+    write_file(contents);
+
+    mapped_filebuf buf;
+    assert(buf.pubsetbuf(nullptr, small_window) == &buf);
+    assert(buf.open(test_file));
+    assert(buf.sungetc() == char_traits<char>::eof()); // at the beginning of the file
+
+    // back up over the beginning of the second window, into the first
+    assert(buf.pubseekpos(window_bytes, ios::in) == window_bytes);
+    assert(buf.sgetc() == contents[window_bytes]);
+    assert(buf.sungetc() == contents[window_bytes - 1]);
+    assert(buf.pubseekoff(0, ios::cur, ios::in) == window_bytes - 1);
+    assert(buf.sungetc() == contents[window_bytes - 2]);
+
+    // the mapping is read-only, so only the element that's already there can be put back
+    const char next = contents[window_bytes - 3];
+    assert(buf.sputbackc(next == 'x' ? 'y' : 'x') == char_traits<char>::eof());
+    assert(buf.pubseekoff(0, ios::cur, ios::in) == window_bytes - 2);
+    assert(buf.sputbackc(next) == next);
+    assert(buf.pubseekoff(0, ios::cur, ios::in) == window_bytes - 3);
+
+    assert(buf.pubseekpos(3 * window_bytes, ios::in) == 3 * window_bytes);
+    assert(buf.sgetc() == contents[3 * window_bytes]);
+    assert(buf.pubseekpos(window_bytes, ios::in) == window_bytes); // outside the window, so nothing is mapped
+    assert(buf.sputbackc(contents[window_bytes - 1]) == contents[window_bytes - 1]);
+    assert(buf.sbumpc() == contents[window_bytes - 1]);
+    assert(buf.sbumpc() == contents[window_bytes]);
+}
+
+void test_view() {
+    string contents;
+    long long expected = 0;
+    for (int i = 0; i < 100'000; ++i) {
+        contents += to_string(i);
+        contents += ' ';
+        expected += i;
+    }
+
+    write_file(contents);
+
+    mapped_filebuf buf;
+    assert(buf.open(test_file)); // smaller than the default window, so it's mapped whole
+    long long sum = 0;
+    for (string_view view = buf.view(); !view.empty(); view = buf.view()) {
+        int value         = 0;
+        const auto result  = from_chars(view.data(), view.data() + view.size(), value);
+        assert(result.ec == errc{});
+        sum += value;
+        assert(buf.pubseekoff(result.ptr - view.data() + 1, ios::cur, ios::in) != -1); // skip the space
+    }
+
+    assert(sum == expected);
+    assert(buf.pubseekoff(0, ios::cur, ios::in) == static_cast<streamoff>(contents.size()));
+
+    // views are limited to the current window
+    mapped_filebuf small;
+    assert(small.pubsetbuf(nullptr, small_window) == &small);
+    assert(small.open(test_file));
+    assert(small.pubseekpos(window_bytes - 10, ios::in) == window_bytes - 10);
+    const string_view tail = small.view();
+    assert(tail.size() == 10);
+    assert(tail == string_view{contents}.substr(window_bytes - 10, 10));
+    assert(small.pubseekoff(10, ios::cur, ios::in) == window_bytes);
+    assert(small.view().substr(0, 5) == string_view{contents}.substr(window_bytes, 5));
+}
+
+int main() {
+    test_open_close();
+    test_empty_file();
+    test_extraction();
+    test_lines_across_windows();
+    test_seek();
+    test_putback();
+    test_view();
+
+    fs::remove(test_file);
+}
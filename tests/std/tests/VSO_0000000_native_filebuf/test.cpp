@@ -0,0 +1,204 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <iostream>
+#include <istream>
+#include <ostream>
+#include <string>
+
+using namespace std;
+namespace fs = std::filesystem;
+
+const fs::path test_file{L"native_filebuf_test.dat"};
+
+// Writes and reads back in pieces of many sizes, some smaller than the stream buffer and some much larger.
+constexpr size_t piece_sizes[] = {1, 7, 100, 4095, 4096, 4097, 65'535, 65'536, 200'000, 3, 1'000'000, 12};
+
+string make_contents() {
+    string contents;
+    for (const auto size : piece_sizes) {
+        for (size_t i = 0; i < size; ++i) {
+            contents.push_back(static_cast<char>('a' + (contents.size() * 7 + i) % 26));
+        }
+
+        contents.push_back('\n');
+    }
+
+    return contents;
+}
+
+template <class Filebuf>
+void write_in_pieces(Filebuf& buf, const string& contents) {
+    size_t pos = 0;
+    for (const auto size : piece_sizes) {
+        assert(buf.sputn(contents.data() + pos, static_cast<streamsize>(size)) == static_cast<streamsize>(size));
+        pos += size;
+        assert(buf.sputc(contents[pos]) == contents[pos]);
+        ++pos;
+    }
+
+    assert(pos == contents.size());
+}
+
+template <class Filebuf>
+void read_in_pieces(Filebuf& buf, const string& contents) {
+    string result(contents.size() + 100, '\xFF');
+    size_t pos = 0;
+    for (const auto size : piece_sizes) {
+        assert(buf.sgetn(&result[pos], static_cast<streamsize>(size)) == static_cast<streamsize>(size));
+        pos += size;
+        assert(buf.sbumpc() == '\n');
+        result[pos] = '\n';
+        ++pos;
+    }
+
+    assert(buf.sgetn(&result[pos], 100) == 0);
+    result.resize(pos);
+    assert(result == contents);
+}
+
+void test_filebuf_binary_round_trip(const string& contents) {
+    {
+        filebuf buf;
+        assert(buf.open(test_file, ios::out | ios::trunc | ios::binary));
+        write_in_pieces(buf, contents);
+        assert(buf.close());
+    }
+
+    assert(fs::file_size(test_file) == contents.size());
+
+    filebuf buf;
+    assert(buf.open(test_file, ios::in | ios::binary));
+    read_in_pieces(buf, contents);
+}
+
+void test_filebuf_text_still_translates() {
+    {
+        ofstream out{test_file};
+        const string lines(10'000, '\n');
+        out.write(lines.data(), static_cast<streamsize>(lines.size()));
+    }
+
+    assert(fs::file_size(test_file) == 20'000); // \r\n on disk
+
+    ifstream in{test_file};
+    string result(20'000, '\0');
+    in.read(&result[0], 20'000);
+    assert(in.gcount() == 10'000);
+    assert(all_of(result.begin(), result.begin() + 10'000, [](char ch) { return ch == '\n'; }));
+}
+
+void test_native_round_trip(const string& contents, const streamsize buffer_size) {
+    {
+        stdext::native_filebuf buf;
+        assert(buf.pubsetbuf(nullptr, buffer_size));
+        assert(!buf.is_open());
+        assert(buf.open(test_file, ios::out | ios::trunc));
+        assert(buf.is_open());
+        assert(buf.native_handle() != reinterpret_cast<void*>(-1));
+        write_in_pieces(buf, contents);
+        assert(buf.close());
+        assert(!buf.is_open());
+        assert(!buf.close());
+    }
+
+    assert(fs::file_size(test_file) == contents.size()); // no newline translation
+
+    stdext::native_filebuf buf;
+    assert(buf.pubsetbuf(nullptr, buffer_size));
+    assert(buf.open(test_file, ios::in));
+    read_in_pieces(buf, contents);
+}
+
+void test_native_streams(const string& contents) {
+    stdext::native_filebuf buf;
+    assert(buf.pubsetbuf(nullptr, 64));
+    assert(buf.open(test_file.native(), ios::in | ios::out));
+    iostream stream{&buf};
+
+    char chars[10];
+    assert(stream.read(chars, 10));
+    assert(equal(chars, chars + 10, contents.begin()));
+
+    stream.seekp(0, ios::cur); // writes go after what has been read, not after what has been buffered
+    assert(stream.write("XYZ", 3));
+    stream.seekg(0, ios::cur);
+    assert(stream.read(chars, 2));
+    assert(chars[0] == contents[13] && chars[1] == contents[14]);
+
+    stream.seekg(-1, ios::end);
+    assert(stream.get() == '\n');
+    assert(stream.tellg() == static_cast<streamoff>(contents.size()));
+
+    stream.seekg(5);
+    assert(stream.read(chars, 10));
+    assert(string(chars, 10) == contents.substr(5, 5) + "XYZ" + contents.substr(13, 2));
+
+    stream.seekg(0);
+    string line;
+    size_t line_count = 0;
+    while (getline(stream, line)) {
+        ++line_count;
+    }
+
+    assert(line_count == size(piece_sizes));
+}
+
+void test_native_open_modes() {
+    {
+        stdext::native_filebuf buf;
+        assert(buf.open(test_file, ios::out | ios::trunc));
+        assert(buf.sputn("head", 4) == 4);
+        assert(!buf.open(test_file, ios::in)); // already open
+    }
+
+    {
+        stdext::native_filebuf buf;
+        assert(buf.open(test_file, ios::app));
+        assert(buf.sputn("tail", 4) == 4);
+    }
+
+    {
+        stdext::native_filebuf buf;
+        assert(buf.open(test_file, ios::in | ios::ate));
+        assert(buf.pubseekoff(0, ios::cur) == streamoff{8});
+        assert(buf.pubseekpos(0) == streamoff{0});
+        char chars[8];
+        assert(buf.sgetn(chars, 8) == 8);
+        assert(string(chars, 8) == "headtail");
+    }
+
+    assert(!stdext::native_filebuf{}.open(test_file, ios::out | ios::_Noreplace));
+    assert(!stdext::native_filebuf{}.open(test_file, ios::in | ios::trunc));
+    assert(!stdext::native_filebuf{}.open(test_file, ios::trunc | ios::app));
+    assert(!stdext::native_filebuf{}.open(test_file, ios::binary));
+
+    fs::remove(test_file);
+    assert(!stdext::native_filebuf{}.open(test_file, ios::in)); // doesn't exist
+    assert(!stdext::native_filebuf{}.open(test_file, ios::in | ios::out));
+    assert(stdext::native_filebuf{}.open(test_file, ios::out | ios::_Noreplace));
+    assert(fs::exists(test_file));
+}
+
+int main() {
+    const string contents = make_contents();
+
+    test_filebuf_binary_round_trip(contents);
+    test_filebuf_text_still_translates();
+
+    test_native_round_trip(contents, 1);
+    test_native_round_trip(contents, 4096);
+    test_native_round_trip(contents, 64 * 1024);
+    test_native_round_trip(contents, 1 << 20);
+    test_native_streams(contents);
+    test_native_open_modes();
+
+    fs::remove(test_file);
+}
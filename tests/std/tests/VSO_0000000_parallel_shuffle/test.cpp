@@ -0,0 +1,143 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace std::execution;
+
+// sizes below and above the threshold where the bucketed parallel algorithm takes over
+constexpr size_t sizes[] = {0, 1, 2, 100, 32767, 32768, 32769, 100'000, 1'000'003};
+
+template <class ExPo>
+void test_permutation(const ExPo& exec) {
+    for (const size_t n : sizes) {
+        vector<size_t> v(n);
+        iota(v.begin(), v.end(), size_t{0});
+        mt19937_64 gen(1729);
+        shuffle(exec, v.begin(), v.end(), gen);
+
+        vector<size_t> sorted_v(v);
+        sort(sorted_v.begin(), sorted_v.end());
+        for (size_t i = 0; i < n; ++i) {
+            assert(sorted_v[i] == i);
+        }
+
+        if (n >= 100) {
+            size_t fixed_points = 0;
+            for (size_t i = 0; i < n; ++i) {
+                fixed_points += v[i] == i;
+            }
+
+            assert(fixed_points < 20); // expected value is 1
+        }
+    }
+}
+
+void test_deterministic() {
+    // the result depends only on the engine's state, not on how the work happens to be scheduled
+    for (const size_t n : sizes) {
+        vector<size_t> first(n);
+        iota(first.begin(), first.end(), size_t{0});
+        vector<size_t> second(first);
+
+        mt19937 gen1(42);
+        mt19937 gen2(42);
+        shuffle(par, first.begin(), first.end(), gen1);
+        shuffle(par_unseq, second.begin(), second.end(), gen2);
+        assert(first == second);
+        assert(gen1 == gen2);
+    }
+}
+
+void test_sequenced_matches_serial() {
+    vector<int> expected(50'000);
+    iota(expected.begin(), expected.end(), 0);
+    vector<int> actual(expected);
+
+    mt19937 gen1(5);
+    mt19937 gen2(5);
+    shuffle(expected.begin(), expected.end(), gen1);
+    shuffle(seq, actual.begin(), actual.end(), gen2);
+    assert(expected == actual);
+}
+
+void test_move_only_and_nontrivial() {
+    const size_t n = 70'000;
+    vector<unique_ptr<size_t>> v;
+    v.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        v.push_back(make_unique<size_t>(i));
+    }
+
+    minstd_rand gen;
+    shuffle(par, v.begin(), v.end(), gen);
+    vector<bool> seen(n);
+    for (const auto& p : v) {
+        assert(p);
+        assert(!seen[*p]);
+        seen[*p] = true;
+    }
+
+    vector<string> strs(n);
+    for (size_t i = 0; i < n; ++i) {
+        strs[i] = "a string long enough to defeat the small string optimization #" + to_string(i);
+    }
+
+    vector<string> expected(strs);
+    shuffle(par, strs.begin(), strs.end(), gen);
+    sort(strs.begin(), strs.end());
+    sort(expected.begin(), expected.end());
+    assert(strs == expected);
+}
+
+void test_uniformity() {
+    // chi-squared test on the final position of the first and the last element
+    constexpr size_t n      = 32768;
+    constexpr size_t bins   = 16;
+    constexpr int trials    = 800;
+    constexpr double expect = static_cast<double>(trials) / bins;
+    // critical value of the chi-squared distribution with 15 degrees of freedom for p = 0.001
+    constexpr double critical = 37.697;
+
+    vector<size_t> v(n);
+    size_t first_counts[bins]{};
+    size_t last_counts[bins]{};
+    mt19937_64 gen(2024);
+    for (int trial = 0; trial < trials; ++trial) {
+        iota(v.begin(), v.end(), size_t{0});
+        shuffle(par, v.begin(), v.end(), gen);
+        const auto first_pos = static_cast<size_t>(find(v.begin(), v.end(), size_t{0}) - v.begin());
+        const auto last_pos  = static_cast<size_t>(find(v.begin(), v.end(), n - 1) - v.begin());
+        ++first_counts[first_pos * bins / n];
+        ++last_counts[last_pos * bins / n];
+    }
+
+    double first_chi2 = 0.0;
+    double last_chi2  = 0.0;
+    for (size_t bin = 0; bin < bins; ++bin) {
+        first_chi2 += (first_counts[bin] - expect) * (first_counts[bin] - expect) / expect;
+        last_chi2 += (last_counts[bin] - expect) * (last_counts[bin] - expect) / expect;
+    }
+
+    assert(first_chi2 < critical);
+    assert(last_chi2 < critical);
+}
+
+int main() {
+    test_permutation(seq);
+    test_permutation(par);
+    test_permutation(par_unseq);
+    test_deterministic();
+    test_sequenced_matches_serial();
+    test_move_only_and_nontrivial();
+    test_uniformity();
+}
@@ -0,0 +1,167 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <cstddef>
+#include <map>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+class throwing_resource : public pmr::memory_resource {
+private:
+    void* do_allocate(size_t, size_t) override {
+        throw bad_alloc{};
+    }
+
+    void do_deallocate(void*, size_t, size_t) override {
+        assert(false);
+    }
+
+    bool do_is_equal(const pmr::memory_resource& that) const noexcept override {
+        return this == &that;
+    }
+};
+
+void test_counters() {
+    stdext::pmr::statistics_resource stats{pmr::new_delete_resource()};
+    assert(stats.upstream_resource() == pmr::new_delete_resource());
+    assert(stats.is_equal(stats));
+    assert(!stats.is_equal(*pmr::new_delete_resource()));
+
+    {
+        const auto snap = stats.snapshot();
+        assert(snap.allocations == 0);
+        assert(snap.live_bytes == 0);
+        assert(snap.peak_bytes == 0);
+    }
+
+    void* const p1 = stats.allocate(100, 8);
+    void* const p2 = stats.allocate(1, 1);
+    void* const p3 = stats.allocate(4096, 64);
+    {
+        const auto snap = stats.snapshot();
+        assert(snap.allocations == 3);
+        assert(snap.deallocations == 0);
+        assert(snap.bytes_allocated == 4197);
+        assert(snap.live_bytes == 4197);
+        assert(snap.peak_bytes == 4197);
+        assert(snap.size_histogram[0] == 1); // 1 byte
+        assert(snap.size_histogram[7] == 1); // (64, 128] bytes
+        assert(snap.size_histogram[12] == 1); // (2048, 4096] bytes
+        assert(snap.alignment_histogram[0] == 1);
+        assert(snap.alignment_histogram[3] == 1);
+        assert(snap.alignment_histogram[6] == 1);
+    }
+
+    stats.deallocate(p3, 4096, 64);
+    stats.deallocate(p2, 1, 1);
+    {
+        const auto snap = stats.snapshot();
+        assert(snap.deallocations == 2);
+        assert(snap.bytes_deallocated == 4097);
+        assert(snap.live_bytes == 100);
+        assert(snap.peak_bytes == 4197);
+    }
+
+    stats.reset_peak();
+    assert(stats.snapshot().peak_bytes == 100);
+    void* const p4 = stats.allocate(50, 2);
+    assert(stats.snapshot().peak_bytes == 150);
+    stats.deallocate(p4, 50, 2);
+    stats.deallocate(p1, 100, 8);
+
+    const auto snap = stats.snapshot();
+    assert(snap.allocations == snap.deallocations);
+    assert(snap.bytes_allocated == snap.bytes_deallocated);
+    assert(snap.live_bytes == 0);
+    assert(snap.peak_bytes == 150);
+    unsigned long long total = 0;
+    for (const auto count : snap.size_histogram) {
+        total += count;
+    }
+    assert(total == snap.allocations);
+}
+
+void test_failed_allocation() {
+    throwing_resource upstream;
+    stdext::pmr::statistics_resource stats{&upstream};
+    try {
+        (void) stats.allocate(16);
+        assert(false);
+    } catch (const bad_alloc&) {
+    }
+
+    const auto snap = stats.snapshot();
+    assert(snap.allocations == 0);
+    assert(snap.live_bytes == 0);
+    assert(snap.size_histogram[4] == 0);
+}
+
+void test_pool_upstream() {
+    // observe how a pool resource draws on its upstream
+    stdext::pmr::statistics_resource stats;
+    assert(stats.upstream_resource() == pmr::get_default_resource());
+    {
+        pmr::unsynchronized_pool_resource pool{&stats};
+        pmr::map<int, pmr::string> m{&pool};
+        for (int i = 0; i < 1000; ++i) {
+            m.emplace(i, "a string long enough to need its own allocation");
+        }
+
+        const auto snap = stats.snapshot();
+        assert(snap.allocations > 0);
+        assert(snap.live_bytes > 1000 * sizeof(pmr::string));
+        assert(snap.peak_bytes >= snap.live_bytes);
+    }
+
+    const auto snap = stats.snapshot();
+    assert(snap.live_bytes == 0);
+    assert(snap.allocations == snap.deallocations);
+}
+
+void test_threads() {
+    stdext::pmr::statistics_resource stats;
+    constexpr int thread_count = 8;
+    constexpr int iterations   = 10000;
+    vector<thread> threads;
+    for (int t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&stats, t] {
+            const size_t size = static_cast<size_t>(t + 1) * 16;
+            vector<void*> ptrs;
+            for (int i = 0; i < iterations; ++i) {
+                ptrs.push_back(stats.allocate(size));
+                if (i % 2 == 1) {
+                    stats.deallocate(ptrs.back(), size);
+                    ptrs.pop_back();
+                }
+            }
+
+            for (const auto ptr : ptrs) {
+                stats.deallocate(ptr, size);
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    const auto snap = stats.snapshot();
+    assert(snap.allocations == thread_count * iterations);
+    assert(snap.deallocations == thread_count * iterations);
+    assert(snap.live_bytes == 0);
+    assert(snap.peak_bytes >= (iterations / 2) * 16 * thread_count);
+    assert(snap.peak_bytes <= (iterations / 2 + 1) * 16 * (thread_count * (thread_count + 1) / 2));
+}
+
+int main() {
+    test_counters();
+    test_failed_allocation();
+    test_pool_upstream();
+    test_threads();
+}
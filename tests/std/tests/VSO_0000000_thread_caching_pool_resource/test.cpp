@@ -0,0 +1,220 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+class counting_resource : public pmr::memory_resource {
+public:
+    atomic<size_t> live_bytes{0};
+    atomic<size_t> live_allocations{0};
+
+private:
+    void* do_allocate(const size_t bytes, const size_t align) override {
+        void* const ptr = pmr::new_delete_resource()->allocate(bytes, align);
+        live_bytes += bytes;
+        ++live_allocations;
+        return ptr;
+    }
+
+    void do_deallocate(void* const ptr, const size_t bytes, const size_t align) override {
+        assert(live_bytes >= bytes);
+        assert(live_allocations != 0);
+        live_bytes -= bytes;
+        --live_allocations;
+        pmr::new_delete_resource()->deallocate(ptr, bytes, align);
+    }
+
+    bool do_is_equal(const pmr::memory_resource& that) const noexcept override {
+        return this == &that;
+    }
+};
+
+struct block {
+    unsigned char* ptr;
+    size_t bytes;
+    size_t align;
+};
+
+block make_block(pmr::memory_resource& res, const size_t bytes, const size_t align) {
+    const auto ptr = static_cast<unsigned char*>(res.allocate(bytes, align));
+    assert(reinterpret_cast<uintptr_t>(ptr) % align == 0);
+    memset(ptr, static_cast<int>(bytes & 0xFF), bytes);
+    return {ptr, bytes, align};
+}
+
+void free_block(pmr::memory_resource& res, const block& b) {
+    for (size_t i = 0; i < b.bytes; ++i) {
+        assert(b.ptr[i] == static_cast<unsigned char>(b.bytes & 0xFF));
+    }
+
+    res.deallocate(b.ptr, b.bytes, b.align);
+}
+
+// shared between threads, so that blocks are often freed by a thread other than the one that allocated them
+struct handoff {
+    mutex mtx;
+    vector<block> blocks;
+};
+
+void run_threads(stdext::pmr::thread_caching_pool_resource& res, handoff& shared, const unsigned int seed) {
+    constexpr int thread_count = 8;
+    constexpr int iterations   = 20'000;
+
+    vector<thread> threads;
+    for (int t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&res, &shared, t, seed] {
+            mt19937 gen(seed + static_cast<unsigned int>(t));
+            vector<block> mine;
+            for (int i = 0; i < iterations; ++i) {
+                switch (gen() % 4) {
+                case 0:
+                case 1:
+                    {
+                        // mostly small sizes, sometimes sizes beyond the cached pools or beyond all pools
+                        const size_t bytes = 1 + gen() % (gen() % 16 == 0 ? 40'000 : 256);
+                        const size_t align = size_t{1} << (gen() % 6);
+                        mine.push_back(make_block(res, bytes, align));
+                        break;
+                    }
+                case 2:
+                    if (!mine.empty()) {
+                        free_block(res, mine.back());
+                        mine.pop_back();
+                    }
+                    break;
+                default:
+                    {
+                        lock_guard<mutex> lck{shared.mtx};
+                        if (!mine.empty() && gen() % 2 == 0) {
+                            shared.blocks.push_back(mine.back());
+                            mine.pop_back();
+                        } else if (!shared.blocks.empty()) {
+                            free_block(res, shared.blocks.back());
+                            shared.blocks.pop_back();
+                        }
+                    }
+                    break;
+                }
+            }
+
+            for (const auto& b : mine) {
+                free_block(res, b);
+            }
+        });
+    }
+
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    for (const auto& b : shared.blocks) {
+        free_block(res, b);
+    }
+
+    shared.blocks.clear();
+}
+
+void test_threads_and_release() {
+    counting_resource upstream;
+    {
+        stdext::pmr::thread_caching_pool_resource res{pmr::pool_options{0, 16'384}, &upstream};
+        handoff shared;
+        run_threads(res, shared, 1729);
+        assert(upstream.live_allocations != 0); // caches and chunks are retained until release
+
+        res.release();
+        assert(upstream.live_bytes == 0);
+        assert(upstream.live_allocations == 0);
+
+        // the resource is usable again after release
+        run_threads(res, shared, 42);
+        const block b = make_block(res, 24, 8);
+        free_block(res, b);
+    }
+
+    // destruction returns everything, too
+    assert(upstream.live_bytes == 0);
+    assert(upstream.live_allocations == 0);
+}
+
+void test_pmr_containers() {
+    counting_resource upstream;
+    {
+        stdext::pmr::thread_caching_pool_resource res{&upstream};
+        vector<thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&res, t] {
+                pmr::vector<pmr::vector<int>> nested{&res};
+                for (int i = 0; i < 1000; ++i) {
+                    nested.emplace_back(static_cast<size_t>(i % 50), t);
+                }
+
+                for (const auto& v : nested) {
+                    for (const int x : v) {
+                        assert(x == t);
+                    }
+                }
+            });
+        }
+
+        for (auto& th : threads) {
+            th.join();
+        }
+    }
+
+    assert(upstream.live_bytes == 0);
+    assert(upstream.live_allocations == 0);
+}
+
+void test_short_lived_threads() {
+    // Threads that exit leave their caches behind; sweeps hand those blocks back to the pools for later threads.
+    counting_resource upstream;
+    {
+        stdext::pmr::thread_caching_pool_resource res{&upstream};
+        for (int t = 0; t < 200; ++t) {
+            thread th{[&res, t] {
+                vector<block> mine;
+                for (size_t bytes = 1; bytes <= 4'000; bytes = bytes * 2 + static_cast<size_t>(t % 7)) {
+                    mine.push_back(make_block(res, bytes, alignof(max_align_t)));
+                }
+
+                for (const auto& b : mine) {
+                    free_block(res, b);
+                }
+            }};
+            th.join();
+        }
+
+        // the main thread keeps working after all of the others have exited
+        vector<block> mine;
+        for (int i = 0; i < 10'000; ++i) {
+            mine.push_back(make_block(res, 1 + static_cast<size_t>(i % 3'000), 8));
+        }
+
+        for (const auto& b : mine) {
+            free_block(res, b);
+        }
+    }
+
+    assert(upstream.live_bytes == 0);
+    assert(upstream.live_allocations == 0);
+}
+
+int main() {
+    test_threads_and_release();
+    test_pmr_containers();
+    test_short_lived_threads();
+}
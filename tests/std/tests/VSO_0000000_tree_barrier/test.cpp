@@ -0,0 +1,158 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <atomic>
+#include <barrier>
+#include <cassert>
+#include <cstddef>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using stdext::tree_barrier;
+
+void test() {
+    tree_barrier<> b(2);
+
+    std::atomic<int> c{0};
+
+    std::thread t1([&] {
+        for (int i = 0; i < 5; ++i) {
+            auto token = b.arrive();
+            b.wait(std::move(token));
+            c.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    std::thread t2([&] {
+        for (int i = 0; i < 3; ++i) {
+            b.arrive_and_wait();
+            c.fetch_add(1, std::memory_order_relaxed);
+        }
+        b.arrive_and_drop();
+    });
+
+    t1.join();
+    t2.join();
+
+    assert(c.load(std::memory_order_relaxed) == 8);
+}
+
+void test_token() {
+    std::atomic<int> called_times{0};
+
+    auto f = [&]() noexcept { called_times.fetch_add(1, std::memory_order_relaxed); };
+
+    tree_barrier b(2, f);
+    auto t1 = b.arrive();
+    auto t2 = std::move(t1);
+
+    assert(called_times.load(std::memory_order_relaxed) == 0);
+    auto t3 = b.arrive();
+    auto t4 = std::move(t3);
+
+    assert(called_times.load(std::memory_order_relaxed) == 1);
+    b.wait(std::move(t4));
+    assert(called_times.load(std::memory_order_relaxed) == 1);
+    b.wait(std::move(t2));
+    assert(called_times.load(std::memory_order_relaxed) == 1);
+}
+
+void test_many_threads(const int thread_count) {
+    // check the completion step sees every arrival's writes, and every waiter sees the completion step's writes
+    constexpr int phase_count = 20;
+    std::vector<int> written(static_cast<std::size_t>(thread_count));
+    int completed_phases = 0;
+    int phase_sum        = 0;
+
+    auto on_completion = [&]() noexcept {
+        ++completed_phases;
+        phase_sum = 0;
+        for (const int value : written) {
+            phase_sum += value;
+        }
+    };
+    tree_barrier b(thread_count, on_completion);
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < thread_count; ++i) {
+        threads.emplace_back([&, i] {
+            for (int phase = 1; phase <= phase_count; ++phase) {
+                written[static_cast<std::size_t>(i)] = phase;
+                if (i % 2 == 0) {
+                    b.arrive_and_wait();
+                } else {
+                    b.wait(b.arrive());
+                }
+
+                assert(phase_sum == phase * thread_count);
+                b.arrive_and_wait(); // keep the next phase's writes out of the completion step above
+            }
+
+            if (i % 3 == 0) {
+                b.arrive_and_drop();
+                return;
+            }
+
+            written[static_cast<std::size_t>(i)] = 0;
+            b.arrive_and_wait();
+            b.arrive_and_wait();
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    assert(completed_phases == 2 * phase_count + 2);
+}
+
+void test_many_arrivals_at_once(const std::ptrdiff_t update) {
+    // arrive(update) may cover several leaves of the tree
+    tree_barrier<> b(4 * update);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&b, update] {
+            for (int phase = 0; phase < 50; ++phase) {
+                b.wait(b.arrive(update));
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+}
+
+void barrier_callback_function() noexcept {}
+
+void test_functor_types() {
+    struct Functor {
+        void operator()() noexcept {}
+    };
+
+    tree_barrier<Functor> b1{1};
+    tree_barrier<void (*)() noexcept> b2{1, barrier_callback_function};
+    tree_barrier b3{1, []() noexcept {}};
+
+    b1.arrive_and_wait();
+    b2.arrive_and_wait();
+    b3.arrive_and_wait();
+
+    static_assert(tree_barrier<>::max() == std::barrier<>::max());
+    static_assert(!std::is_copy_constructible_v<tree_barrier<>>);
+    static_assert(!std::is_copy_assignable_v<tree_barrier<>>);
+}
+
+int main() {
+    test();
+    test_token();
+    test_many_threads(1);
+    test_many_threads(7);
+    test_many_threads(32);
+    test_many_threads(100);
+    test_many_arrivals_at_once(25);
+    test_many_arrivals_at_once(1000); // more than the tree has leaves for
+    test_functor_types();
+}
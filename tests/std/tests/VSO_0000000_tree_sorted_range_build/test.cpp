@@ -0,0 +1,267 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+// Exposes the nodes of a map or set, to check the red-black tree invariants after building it from a range.
+template <class Base>
+struct probe : Base {
+    using Base::Base;
+
+    void check() const {
+        const auto head = this->_Get_scary()->_Myhead;
+        if (head->_Parent->_Isnil) {
+            assert(head->_Left == head);
+            assert(head->_Right == head);
+            assert(this->empty());
+            return;
+        }
+
+        assert(head->_Parent->_Color == black);
+        assert(head->_Parent->_Parent == head);
+        assert(addressof(head->_Left->_Myval) == addressof(*this->begin()));
+        assert(addressof(head->_Right->_Myval) == addressof(*prev(this->end())));
+
+        size_t count = 0;
+        (void) black_height(head->_Parent, head->_Parent->_Parent, count);
+        assert(count == this->size());
+        assert(static_cast<size_t>(distance(this->begin(), this->end())) == count);
+
+        if (this->size() > 1) {
+            const auto comp = this->value_comp();
+            for (auto it = next(this->begin()); it != this->end(); ++it) {
+                assert(!comp(*it, *prev(it)));
+            }
+        }
+    }
+
+private:
+    using node    = typename Base::_Node;
+    using nodeptr = typename Base::_Nodeptr;
+
+    static constexpr char red   = node::_Red;
+    static constexpr char black = node::_Black;
+
+    static int black_height(const nodeptr n, const nodeptr parent, size_t& count) {
+        if (n->_Isnil) {
+            return 1;
+        }
+
+        assert(n->_Parent == parent);
+        if (n->_Color == red) {
+            assert(n->_Left->_Color == black);
+            assert(n->_Right->_Color == black);
+        }
+
+        const int left  = black_height(n->_Left, n, count);
+        const int right = black_height(n->_Right, n, count);
+        assert(left == right);
+        ++count;
+        return left + (n->_Color == black ? 1 : 0);
+    }
+};
+
+using checked_set      = probe<set<int>>;
+using checked_multiset = probe<multiset<int>>;
+using checked_map      = probe<map<int, int>>;
+using checked_multimap = probe<multimap<int, int>>;
+
+vector<int> iota_vector(const int n) {
+    vector<int> v;
+    for (int i = 0; i < n; ++i) {
+        v.push_back(i * 2);
+    }
+
+    return v;
+}
+
+void test_sorted_sizes() {
+    for (int n = 0; n < 300; ++n) {
+        const auto v = iota_vector(n);
+        checked_set s(v.begin(), v.end());
+        s.check();
+        assert(equal(s.begin(), s.end(), v.begin(), v.end()));
+
+        // the tree stays valid as it's modified afterwards
+        s.insert(-1);
+        s.insert(n);
+        s.check();
+        for (int i = 0; i < n; i += 3) {
+            s.erase(i * 2);
+        }
+
+        s.check();
+    }
+
+    const auto big = iota_vector(100'000);
+    checked_set s(big.begin(), big.end());
+    s.check();
+    assert(s.size() == big.size());
+}
+
+void test_duplicates() {
+    const vector<pair<int, int>> v{{1, 0}, {1, 1}, {2, 2}, {3, 3}, {3, 4}, {3, 5}, {4, 6}};
+
+    checked_map m(v.begin(), v.end());
+    m.check();
+    assert(m.size() == 4);
+    assert(m.at(1) == 0); // the first of equivalent elements is inserted
+    assert(m.at(3) == 3);
+
+    checked_multimap mm(v.begin(), v.end());
+    mm.check();
+    const auto same_pair = [](const pair<const int, int>& left, const pair<int, int>& right) {
+        return left.first == right.first && left.second == right.second;
+    };
+    assert(equal(mm.begin(), mm.end(), v.begin(), v.end(), same_pair)); // equivalent elements keep their order
+
+    const vector<int> same(100, 7);
+    checked_set s(same.begin(), same.end());
+    s.check();
+    assert(s.size() == 1);
+
+    checked_multiset ms(same.begin(), same.end());
+    ms.check();
+    assert(ms.size() == 100);
+}
+
+void test_nearly_sorted() {
+    auto v = iota_vector(1000);
+    swap(v[500], v[700]);
+    v.push_back(1); // out of order at the end
+    v.push_back(10); // duplicate after the out of order element
+
+    checked_set s(v.begin(), v.end());
+    s.check();
+    assert(s.size() == 1001);
+    sort(v.begin(), v.end());
+    v.erase(unique(v.begin(), v.end()), v.end());
+    assert(equal(s.begin(), s.end(), v.begin(), v.end()));
+
+    vector<pair<int, int>> reversed;
+    for (int i = 100; i > 0; --i) {
+        reversed.emplace_back(i, i);
+    }
+
+    checked_multimap mm(reversed.begin(), reversed.end());
+    mm.check();
+    assert(mm.size() == 100);
+    assert(mm.begin()->first == 1);
+}
+
+void test_insert() {
+    const auto v = iota_vector(500);
+
+    checked_set s;
+    s.insert(v.begin(), v.end()); // into an empty container
+    s.check();
+    assert(s.size() == 500);
+
+    const auto odd = [] {
+        vector<int> result;
+        for (int i = 0; i < 500; ++i) {
+            result.push_back(i * 2 + 1);
+        }
+
+        return result;
+    }();
+
+    s.insert(odd.begin(), odd.end()); // into a nonempty one
+    s.check();
+    assert(s.size() == 1000);
+
+    checked_multiset ms{5, 1, 3};
+    ms.check();
+    ms.insert({1, 2, 3});
+    ms.check();
+    assert(ms.size() == 6);
+    assert(ms.count(1) == 2);
+}
+
+void test_input_iterators() {
+    istringstream stream{"1 2 3 4 4 5 9 7 8"};
+    checked_set s(istream_iterator<int>{stream}, istream_iterator<int>{});
+    s.check();
+    assert(s.size() == 8);
+    assert(*s.rbegin() == 9);
+}
+
+int live_throwers = 0;
+int copies_left   = 1'000'000;
+
+struct thrower {
+    int value;
+
+    explicit thrower(const int v) : value(v) {
+        ++live_throwers;
+    }
+
+    thrower(const thrower& other) : value(other.value) {
+        if (copies_left-- == 0) {
+            throw runtime_error{"copy failed"};
+        }
+
+        ++live_throwers;
+    }
+
+    thrower& operator=(const thrower&) = delete;
+
+    ~thrower() {
+        --live_throwers;
+    }
+
+    friend bool operator<(const thrower& left, const thrower& right) {
+        return left.value < right.value;
+    }
+};
+
+void test_exceptions() {
+    vector<thrower> v;
+    v.reserve(100);
+    for (int i = 0; i < 100; ++i) {
+        v.emplace_back(i);
+    }
+
+    for (int fail_at : {0, 1, 2, 50, 99}) {
+        copies_left = fail_at;
+        try {
+            probe<set<thrower>> s(v.begin(), v.end());
+            assert(false);
+        } catch (const runtime_error&) {
+        }
+
+        assert(live_throwers == 100);
+
+        probe<set<thrower>> s;
+        copies_left = fail_at;
+        try {
+            s.insert(v.begin(), v.end());
+            assert(false);
+        } catch (const runtime_error&) {
+        }
+
+        s.check(); // the elements copied before the exception form a valid tree
+        assert(s.size() == static_cast<size_t>(fail_at));
+        assert(live_throwers == 100 + fail_at);
+    }
+}
+
+int main() {
+    test_sorted_sizes();
+    test_duplicates();
+    test_nearly_sorted();
+    test_insert();
+    test_input_iterators();
+    test_exceptions();
+}
@@ -0,0 +1,392 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <deque>
+#include <list>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if _HAS_CXX17
+#include <memory_resource>
+#endif // _HAS_CXX17
+
+using namespace std;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+int live_count         = 0;
+int move_count         = 0;
+int assignment_count   = 0;
+int copies_until_throw = -1; // negative: copies never throw
+
+// owns a heap allocation and counts the special member functions that relocation avoids
+struct tracked {
+    int* ptr;
+
+    explicit tracked(const int val) : ptr(new int{val}) {
+        ++live_count;
+    }
+
+    tracked(const tracked& other) : ptr(nullptr) {
+        if (copies_until_throw == 0) {
+            throw runtime_error{"copy failed"};
+        }
+
+        if (copies_until_throw > 0) {
+            --copies_until_throw;
+        }
+
+        ptr = new int{*other.ptr};
+        ++live_count;
+    }
+
+    tracked(tracked&& other) noexcept : ptr(exchange(other.ptr, nullptr)) {
+        ++live_count;
+        ++move_count;
+    }
+
+    tracked& operator=(const tracked& other) {
+        if (ptr) {
+            *ptr = *other.ptr;
+        } else { // moved-from
+            ptr = new int{*other.ptr};
+        }
+
+        ++assignment_count;
+        return *this;
+    }
+
+    tracked& operator=(tracked&& other) noexcept {
+        swap(ptr, other.ptr);
+        ++assignment_count;
+        return *this;
+    }
+
+    ~tracked() {
+        delete ptr;
+        --live_count;
+    }
+
+    int value() const {
+        return *ptr;
+    }
+};
+
+template <>
+constexpr bool stdext::enable_trivial_relocation<tracked> = true;
+
+// must never be relocated; checks that types which don't opt in keep the usual move operations
+struct self_referential {
+    self_referential* self;
+    int value;
+
+    explicit self_referential(const int val) noexcept : self(this), value(val) {}
+    self_referential(const self_referential& other) noexcept : self(this), value(other.value) {}
+
+    self_referential& operator=(const self_referential& other) noexcept {
+        value = other.value;
+        return *this;
+    }
+
+    ~self_referential() {
+        assert(self == this);
+    }
+};
+
+STATIC_ASSERT(_Is_trivially_relocatable_v<int>);
+STATIC_ASSERT(_Is_trivially_relocatable_v<tracked>);
+STATIC_ASSERT(!_Is_trivially_relocatable_v<self_referential>);
+STATIC_ASSERT(_Is_trivially_relocatable_v<unique_ptr<int>>);
+STATIC_ASSERT(_Is_trivially_relocatable_v<unique_ptr<int[]>>);
+STATIC_ASSERT(_Is_trivially_relocatable_v<shared_ptr<int>>);
+STATIC_ASSERT(_Is_trivially_relocatable_v<weak_ptr<int>>);
+STATIC_ASSERT(_Is_trivially_relocatable_v<pair<int, tracked>>);
+STATIC_ASSERT(_Is_trivially_relocatable_v<tuple<tracked, unique_ptr<int>, int>>);
+STATIC_ASSERT(!_Is_trivially_relocatable_v<pair<int&, tracked>>);
+STATIC_ASSERT(!_Is_trivially_relocatable_v<tuple<tracked, self_referential>>);
+
+struct custom_deleter {
+    void operator()(int* const ptr) const noexcept {
+        delete ptr;
+    }
+};
+STATIC_ASSERT(!_Is_trivially_relocatable_v<unique_ptr<int, custom_deleter>>);
+
+#if _ITERATOR_DEBUG_LEVEL == 0
+STATIC_ASSERT(_Is_trivially_relocatable_v<string>);
+STATIC_ASSERT(_Is_trivially_relocatable_v<wstring>);
+STATIC_ASSERT(_Is_trivially_relocatable_v<vector<int>>);
+STATIC_ASSERT(_Is_trivially_relocatable_v<vector<bool>>);
+STATIC_ASSERT(_Is_trivially_relocatable_v<deque<int>>);
+STATIC_ASSERT(_Is_trivially_relocatable_v<list<int>>);
+#else // ^^^ _ITERATOR_DEBUG_LEVEL == 0 / _ITERATOR_DEBUG_LEVEL != 0 vvv
+STATIC_ASSERT(!_Is_trivially_relocatable_v<string>); // the container proxy points back to the string
+STATIC_ASSERT(!_Is_trivially_relocatable_v<vector<int>>);
+#endif // ^^^ _ITERATOR_DEBUG_LEVEL != 0 ^^^
+
+#if _HAS_CXX17
+// polymorphic_allocators neither propagate nor always compare equal, so containers using them aren't relocatable
+STATIC_ASSERT(_Is_trivially_relocatable_v<pmr::polymorphic_allocator<int>>);
+STATIC_ASSERT(!_Is_trivially_relocatable_v<pmr::string>);
+STATIC_ASSERT(!_Is_trivially_relocatable_v<pmr::vector<int>>);
+STATIC_ASSERT(!_Is_trivially_relocatable_v<pmr::deque<int>>);
+STATIC_ASSERT(!_Is_trivially_relocatable_v<pmr::list<int>>);
+#endif // _HAS_CXX17
+
+void assert_values(const vector<tracked>& vec, const vector<int>& expected) {
+    assert(vec.size() == expected.size());
+    for (size_t i = 0; i < vec.size(); ++i) {
+        assert(vec[i].value() == expected[i]);
+    }
+}
+
+void test_reallocation() {
+    {
+        vector<tracked> vec;
+        vector<int> expected;
+        for (int i = 0; i < 1000; ++i) {
+            vec.emplace_back(i);
+            expected.push_back(i);
+        }
+
+        vec.shrink_to_fit();
+        vec.emplace(vec.begin() + 500, -1); // reallocates, because vec.size() == vec.capacity()
+        expected.insert(expected.begin() + 500, -1);
+        vec.reserve(vec.capacity() * 2);
+        vec.resize(vec.capacity() + 1, tracked{-2});
+        expected.resize(vec.size(), -2);
+
+        assert(move_count == 0); // every element was relocated, none moved
+        assert(live_count == static_cast<int>(vec.size()));
+        assert_values(vec, expected);
+    }
+
+    assert(live_count == 0);
+}
+
+void test_insert_erase() {
+    {
+        vector<tracked> vec;
+        vec.reserve(100);
+        for (int i = 0; i < 10; ++i) {
+            vec.emplace_back(i);
+        }
+
+        vec.emplace(vec.begin() + 3, 30);
+        assert_values(vec, {0, 1, 2, 30, 3, 4, 5, 6, 7, 8, 9});
+        assert(move_count == 1); // only from the temporary that guards against aliasing
+
+        vec.insert(vec.begin() + 1, 2, vec[5]);
+        assert_values(vec, {0, 4, 4, 1, 2, 30, 3, 4, 5, 6, 7, 8, 9});
+
+        const tracked more[] = {tracked{-1}, tracked{-2}, tracked{-3}};
+        vec.insert(vec.end() - 1, begin(more), end(more));
+        assert_values(vec, {0, 4, 4, 1, 2, 30, 3, 4, 5, 6, 7, 8, -1, -2, -3, 9});
+
+        vec.erase(vec.begin());
+        assert_values(vec, {4, 4, 1, 2, 30, 3, 4, 5, 6, 7, 8, -1, -2, -3, 9});
+
+        vec.erase(vec.begin() + 2, vec.begin() + 10);
+        assert_values(vec, {4, 4, 8, -1, -2, -3, 9});
+
+        vec.erase(vec.end() - 1);
+        assert_values(vec, {4, 4, 8, -1, -2, -3});
+
+        assert(assignment_count == 0); // nothing was shifted by assignment
+        assert(live_count == 9);
+    }
+
+    assert(live_count == 0);
+    move_count = 0;
+}
+
+void test_insert_exception() {
+    {
+        vector<tracked> vec;
+        vec.reserve(100);
+        for (int i = 0; i < 5; ++i) {
+            vec.emplace_back(i);
+        }
+
+        const tracked val{42};
+        copies_until_throw = 3;
+        try {
+            vec.insert(vec.begin() + 2, 5, val);
+            assert(false);
+        } catch (const runtime_error&) {
+        }
+
+        copies_until_throw = -1;
+        assert_values(vec, {0, 1, 2, 3, 4}); // the gap was closed again
+
+        const tracked range[] = {tracked{7}, tracked{8}, tracked{9}};
+        copies_until_throw    = 1;
+        try {
+            vec.insert(vec.begin() + 1, begin(range), end(range));
+            assert(false);
+        } catch (const runtime_error&) {
+        }
+
+        copies_until_throw = -1;
+        assert_values(vec, {0, 1, 2, 3, 4});
+        assert(live_count == 9);
+    }
+
+    assert(live_count == 0);
+}
+
+void test_not_relocatable() {
+    vector<self_referential> vec;
+    for (int i = 0; i < 100; ++i) {
+        vec.emplace_back(i);
+    }
+
+    vec.emplace(vec.begin() + 50, -1);
+    vec.insert(vec.begin() + 10, 3, self_referential{-2});
+    vec.erase(vec.begin() + 20, vec.begin() + 40);
+    vec.erase(vec.begin());
+    vec.shrink_to_fit();
+
+    for (const auto& elem : vec) {
+        assert(elem.self == &elem);
+    }
+}
+
+void test_library_types() {
+    const string long_string(100, 'x');
+
+    vector<string> strings;
+    for (int i = 0; i < 100; ++i) {
+        strings.push_back(i % 2 == 0 ? to_string(i) : long_string + to_string(i));
+    }
+
+    strings.insert(strings.begin() + 10, "inserted");
+    strings.erase(strings.begin() + 20, strings.begin() + 30);
+    strings.shrink_to_fit();
+    assert(strings[10] == "inserted");
+    assert(strings[0] == "0");
+    assert(strings[1] == long_string + "1");
+    assert(strings.back() == long_string + "99");
+
+    swap_ranges(strings.begin(), strings.begin() + 5, strings.end() - 5);
+    assert(strings[0] == long_string + "95");
+    assert(strings[1] == "96");
+    assert(strings.back() == "4");
+
+    rotate(strings.begin(), strings.begin() + 1, strings.end());
+    assert(strings[0] == "96");
+    assert(strings.back() == long_string + "95");
+
+    vector<unique_ptr<int>> owners;
+    for (int i = 0; i < 100; ++i) {
+        owners.push_back(make_unique<int>(i));
+    }
+
+    owners.erase(owners.begin(), owners.begin() + 50);
+    owners.insert(owners.begin(), make_unique<int>(-1));
+    assert(*owners[0] == -1);
+    assert(*owners[1] == 50);
+    assert(*owners.back() == 99);
+
+    const auto shared = make_shared<int>(1729);
+    {
+        vector<shared_ptr<int>> sharers(10, shared);
+        for (int i = 0; i < 100; ++i) {
+            sharers.push_back(shared);
+        }
+
+        sharers.erase(sharers.begin() + 3);
+        assert(shared.use_count() == 110);
+    }
+
+    assert(shared.use_count() == 1);
+}
+
+#if _HAS_CXX17
+void test_non_propagating_allocators() {
+    // move assignment keeps the destination's memory_resource, so erase and insert mustn't relocate over it
+    const string long_string(100, 'x');
+    pmr::monotonic_buffer_resource first_resource;
+    pmr::monotonic_buffer_resource second_resource;
+    pmr::monotonic_buffer_resource third_resource;
+    const auto resource_of = [](const pmr::string& str) { return str.get_allocator().resource(); };
+
+    vector<pmr::string> strings;
+    strings.reserve(10);
+    strings.emplace_back((long_string + "0").c_str(), &first_resource);
+    strings.emplace_back((long_string + "1").c_str(), &second_resource);
+    strings.erase(strings.begin());
+    assert(strings.size() == 1);
+    assert(strings[0] == long_string + "1");
+    assert(resource_of(strings[0]) == &first_resource);
+
+    strings.emplace_back((long_string + "2").c_str(), &second_resource);
+    strings.insert(strings.begin(), pmr::string{(long_string + "0").c_str(), &third_resource});
+    strings.emplace(strings.begin() + 1, (long_string + "00").c_str(), &third_resource);
+    assert(strings.size() == 4);
+    assert(strings[0] == long_string + "0");
+    assert(strings[1] == long_string + "00");
+    assert(strings[2] == long_string + "1");
+    assert(strings[3] == long_string + "2");
+    assert(resource_of(strings[0]) == &first_resource);
+    assert(resource_of(strings[1]) == &second_resource);
+    assert(resource_of(strings[2]) == &second_resource);
+    assert(resource_of(strings[3]) == &second_resource);
+}
+#endif // _HAS_CXX17
+
+#if _HAS_CXX20
+struct constexpr_relocatable {
+    int value;
+
+    constexpr explicit constexpr_relocatable(const int val) noexcept : value(val) {}
+    constexpr constexpr_relocatable(const constexpr_relocatable& other) noexcept : value(other.value) {}
+    constexpr constexpr_relocatable& operator=(const constexpr_relocatable& other) noexcept {
+        value = other.value;
+        return *this;
+    }
+    constexpr ~constexpr_relocatable() {}
+};
+
+template <>
+constexpr bool stdext::enable_trivial_relocation<constexpr_relocatable> = true;
+
+constexpr bool test_constexpr() { // relocation is a runtime-only optimization
+    vector<constexpr_relocatable> vec;
+    for (int i = 0; i < 20; ++i) {
+        vec.emplace_back(i);
+    }
+
+    vec.emplace(vec.begin(), -1);
+    vec.erase(vec.begin() + 5);
+    assert(vec.size() == 20);
+    assert(vec[0].value == -1);
+    assert(vec[5].value == 5);
+    assert(vec.back().value == 19);
+    return true;
+}
+
+STATIC_ASSERT(test_constexpr());
+#endif // _HAS_CXX20
+
+int main() {
+    test_reallocation();
+    test_insert_erase();
+    test_insert_exception();
+    test_not_relocatable();
+    test_library_types();
+#if _HAS_CXX17
+    test_non_propagating_allocators();
+#endif // _HAS_CXX17
+#if _HAS_CXX20
+    assert(test_constexpr());
+#endif // _HAS_CXX20
+}
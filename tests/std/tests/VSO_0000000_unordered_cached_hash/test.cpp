@@ -0,0 +1,221 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+using namespace std;
+using stdext::hash_caching_allocator;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+STATIC_ASSERT(sizeof(_List_node_for<int, allocator<int>>) == sizeof(_List_node<int, void*>));
+STATIC_ASSERT(sizeof(_List_node_for<int, hash_caching_allocator<int>>) > sizeof(_List_node_for<int, allocator<int>>));
+
+int hash_calls  = 0;
+int equal_calls = 0;
+
+// Hashes i to i * 4096, so that every key lands in bucket 0 until there are more than 4096 buckets.
+struct colliding_hash {
+    size_t operator()(const int i) const {
+        ++hash_calls;
+        return static_cast<size_t>(i) * 4096;
+    }
+};
+
+struct counting_equal {
+    bool operator()(const int left, const int right) const {
+        ++equal_calls;
+        return left == right;
+    }
+};
+
+struct counting_string_hash {
+    size_t operator()(const string& str) const {
+        ++hash_calls;
+        return hash<string>{}(str);
+    }
+};
+
+template <class T>
+using caching_set = unordered_set<T, colliding_hash, counting_equal, hash_caching_allocator<T>>;
+
+template <class T>
+using caching_multiset = unordered_multiset<T, colliding_hash, counting_equal, hash_caching_allocator<T>>;
+
+using caching_map = unordered_map<string, int, counting_string_hash, equal_to<string>,
+    hash_caching_allocator<pair<const string, int>>>;
+
+void reset_counts() {
+    hash_calls  = 0;
+    equal_calls = 0;
+}
+
+void test_lookups_compare_hash_codes_first() {
+    caching_set<int> s;
+    for (int i = 0; i < 500; ++i) {
+        s.insert(i);
+    }
+
+    assert(s.size() == 500);
+    assert(s.bucket_count() <= 4096);
+
+    reset_counts();
+    assert(s.find(1000) == s.end()); // walks all 500 elements of bucket 0
+    assert(hash_calls == 1);
+    assert(equal_calls == 0);
+
+    reset_counts();
+    assert(s.find(123) != s.end());
+    assert(*s.find(123) == 123);
+    assert(s.count(321) == 1);
+    assert(hash_calls == 3);
+    assert(equal_calls == 3);
+
+    reset_counts();
+    assert(!s.insert(42).second);
+    assert(hash_calls == 1);
+    assert(equal_calls == 1);
+
+    reset_counts();
+    assert(s.erase(42) == 1);
+    assert(s.erase(42) == 0);
+    assert(hash_calls == 2);
+    assert(equal_calls == 1);
+    assert(s.size() == 499);
+}
+
+void test_rehash_uses_cached_hash_codes() {
+    caching_set<int> s;
+    for (int i = 0; i < 1000; ++i) {
+        s.insert(i);
+    }
+
+    reset_counts();
+    s.rehash(65536);
+    s.reserve(100000);
+    assert(s.bucket_count() >= 65536);
+    assert(hash_calls == 0);
+    assert(equal_calls == 0);
+
+    reset_counts();
+    for (int i = 0; i < 1000; ++i) {
+        assert(s.find(i) != s.end());
+    }
+
+    assert(hash_calls == 1000);
+    assert(equal_calls == 1000);
+
+    reset_counts();
+    s.erase(s.find(7));
+    s.erase(s.begin(), next(s.begin(), 10));
+    assert(hash_calls == 1); // for find
+    assert(s.size() == 989);
+}
+
+void test_multi() {
+    caching_multiset<int> s;
+    for (int n = 0; n < 3; ++n) {
+        for (int i = 0; i < 100; ++i) {
+            s.insert(i);
+        }
+    }
+
+    reset_counts();
+    const auto range = s.equal_range(50);
+    assert(distance(range.first, range.second) == 3);
+    for (auto it = range.first; it != range.second; ++it) {
+        assert(*it == 50);
+    }
+
+    assert(hash_calls == 1);
+    assert(equal_calls == 3);
+
+    s.rehash(8192);
+    assert(s.count(99) == 3);
+    assert(s.erase(99) == 3);
+    assert(s.count(99) == 0);
+    assert(s.size() == 297);
+}
+
+void test_copies() {
+    caching_map m;
+    for (int i = 0; i < 200; ++i) {
+        m.emplace(string(100, 'x') + to_string(i), i);
+    }
+
+    caching_map copied(m);
+    assert(copied == m);
+
+    caching_map assigned;
+    assigned.emplace("reused node", -1);
+    assigned = m; // reuses the existing node for another element
+    assert(assigned == m);
+    assert(assigned.count("reused node") == 0);
+
+    reset_counts();
+    assigned.rehash(assigned.bucket_count() * 4);
+    assert(hash_calls == 0);
+    for (int i = 0; i < 200; ++i) {
+        assert(assigned.at(string(100, 'x') + to_string(i)) == i);
+    }
+
+    caching_map moved(move(copied));
+    assert(moved == m);
+    assert(copied.empty());
+    moved.swap(copied);
+    assert(copied == m);
+}
+
+#if _HAS_CXX17
+void test_node_handles() {
+    caching_map source;
+    caching_map target;
+    source.emplace("alpha", 1);
+    source.emplace("beta", 2);
+    source.emplace("gamma", 3);
+
+    auto node  = source.extract("beta");
+    node.key() = "delta"; // the hash code cached for "beta" is stale now
+    assert(target.insert(move(node)).inserted);
+    assert(target.count("delta") == 1);
+    assert(target.count("beta") == 0);
+
+    target.emplace("alpha", 10);
+    target.merge(source);
+    assert(source.size() == 1); // "alpha" is already in target
+    assert(target.size() == 3);
+    assert(target.at("alpha") == 10);
+    assert(target.at("gamma") == 3);
+
+    target.rehash(1024);
+    assert(target.at("delta") == 2);
+    assert(target.at("gamma") == 3);
+}
+#endif // _HAS_CXX17
+
+void test_list() {
+    list<int, hash_caching_allocator<int>> l{3, 1, 2};
+    l.sort();
+    assert(l.front() == 1);
+    assert(l.back() == 3);
+}
+
+int main() {
+    test_lookups_compare_hash_codes_first();
+    test_rehash_uses_cached_hash_codes();
+    test_multi();
+    test_copies();
+#if _HAS_CXX17
+    test_node_handles();
+#endif // _HAS_CXX17
+    test_list();
+}
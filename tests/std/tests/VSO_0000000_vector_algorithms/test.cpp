@@ -543,6 +543,41 @@ void test_search(mt19937_64& gen) {
     }
 }
 
+template <class T>
+void test_search_long(mt19937_64& gen) {
+    // long haystacks and needles, including the sizes where Horspool's algorithm takes over for 1-byte elements
+    constexpr size_t haystack_sizes[] = {4095, 4096, 20'000};
+    constexpr size_t needle_sizes[]   = {2, 7, 8, 9, 64, 255, 256, 257, 1000, 4095};
+
+    using TD = conditional_t<sizeof(T) == 1, int, T>;
+    uniform_int_distribution<TD> dis('0', '3');
+    vector<T> input_haystack;
+    vector<T> input_needle;
+
+    for (const size_t haystack_size : haystack_sizes) {
+        input_haystack.resize(haystack_size);
+        for (auto& el : input_haystack) {
+            el = static_cast<T>(dis(gen));
+        }
+
+        for (const size_t needle_size : needle_sizes) {
+            input_needle.resize(needle_size);
+            for (auto& el : input_needle) {
+                el = static_cast<T>(dis(gen));
+            }
+
+            test_case_search(input_haystack, input_needle);
+
+            // plant matches at the beginning, in the middle, and at the end
+            for (const size_t pos : {size_t{0}, (haystack_size - needle_size) / 2, haystack_size - needle_size}) {
+                vector<T> planted = input_haystack;
+                copy(input_needle.begin(), input_needle.end(), planted.begin() + static_cast<ptrdiff_t>(pos));
+                test_case_search(planted, input_needle);
+            }
+        }
+    }
+}
+
 template <class T>
 void test_min_max_element(mt19937_64& gen) {
     using Limits = numeric_limits<T>;
@@ -1176,6 +1211,10 @@ void test_vector_algorithms(mt19937_64& gen) {
     test_search<long long>(gen);
     test_search<unsigned long long>(gen);
 
+    test_search_long<char>(gen);
+    test_search_long<unsigned short>(gen);
+    test_search_long<unsigned int>(gen);
+
     test_min_max_element<char>(gen);
     test_min_max_element<signed char>(gen);
     test_min_max_element<unsigned char>(gen);
@@ -0,0 +1,196 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#define _MSVC_STL_WORDWISE_HASH 1
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#if _HAS_CXX17
+#include <filesystem>
+#include <string_view>
+#endif // _HAS_CXX17
+
+using namespace std;
+
+const string quick_fox = "The quick brown fox jumps over the lazy dog";
+
+struct reference_hash {
+    size_t length;
+    size_t value;
+};
+
+// XXH64 and XXH32 with seed 0 of the first length bytes of quick_fox; these lengths exercise each of the tails
+#ifdef _WIN64
+constexpr reference_hash reference_hashes[] = {{0, 0xEF46DB3751D8E999ULL}, {1, 0x5B4D6AF247A3CF7BULL},
+    {3, 0x4108F90B5DE14D15ULL}, {4, 0xCDF13A49D263200FULL}, {7, 0xC6FCE9D72E310949ULL}, {8, 0xD07B38A78A153B0BULL},
+    {12, 0xB2ED38017844F789ULL}, {15, 0x59BF1A33358C7D98ULL}, {16, 0x0F7E67014943A311ULL},
+    {31, 0x3F8D95AB32C127D9ULL}, {32, 0xE2BBC9136629A4EEULL}, {33, 0x6D92FE2EBAB7DB31ULL},
+    {43, 0x0B242D361FDA71BCULL}};
+constexpr size_t seeded_reference_hash = 0x3F646739897BC6A3ULL; // all of quick_fox, seed 0x1234
+#else // ^^^ defined(_WIN64) / !defined(_WIN64) vvv
+constexpr reference_hash reference_hashes[] = {{0, 0x02CC5D05U}, {1, 0x4DDBE970U}, {3, 0xD4CDE830U},
+    {4, 0x04BE4380U}, {7, 0x1D20C5B6U}, {8, 0xE5B3F5B3U}, {12, 0xE258045BU}, {15, 0x6D1332F9U}, {16, 0xD4FAAFB1U},
+    {31, 0xBABF72E1U}, {32, 0x88C3B301U}, {33, 0xB587D3ACU}, {43, 0xE85EA4DEU}};
+constexpr size_t seeded_reference_hash = 0x0A7CC111U; // all of quick_fox, seed 0x1234
+#endif // ^^^ !defined(_WIN64) ^^^
+
+size_t hash_bytes(const size_t seed, const vector<unsigned char>& bytes) {
+    return _Wordwise_hash_append_bytes(seed, bytes.data(), bytes.size());
+}
+
+void test_reference_values() {
+    for (const auto& ref : reference_hashes) {
+        const string key = quick_fox.substr(0, ref.length);
+        assert(hash<string>{}(key) == ref.value);
+        assert(_Hash_array_representation(key.data(), key.size()) == ref.value);
+#if _HAS_CXX17
+        assert(hash<string_view>{}(key) == ref.value);
+#endif // _HAS_CXX17
+    }
+
+    const auto first = reinterpret_cast<const unsigned char*>(quick_fox.data());
+    assert(_Wordwise_hash_append_bytes(0x1234, first, quick_fox.size()) == seeded_reference_hash);
+    assert(_Wordwise_hash_append_range(0x1234, quick_fox.data(), quick_fox.data() + quick_fox.size())
+           == seeded_reference_hash);
+
+    // values of the size of a word are hashed by their representation, and never collide
+    assert(_Hash_representation(size_t{0}) == _Wordwise_hash_append_value(0, size_t{0}));
+    vector<size_t> hashes;
+    for (size_t i = 0; i < (1 << 20); ++i) {
+        hashes.push_back(_Hash_representation(i * 0x9E3779B1U));
+    }
+
+    sort(hashes.begin(), hashes.end());
+    assert(adjacent_find(hashes.begin(), hashes.end()) == hashes.end());
+}
+
+void test_short_keys() {
+    // every key of up to 2 bytes has a distinct hash
+    vector<size_t> hashes;
+    hashes.push_back(hash<string>{}(string{}));
+    for (int first = 0; first < 256; ++first) {
+        hashes.push_back(hash<string>{}(string(1, static_cast<char>(first))));
+        for (int second = 0; second < 256; ++second) {
+            const char key[] = {static_cast<char>(first), static_cast<char>(second)};
+            hashes.push_back(hash<string>{}(string(key, 2)));
+        }
+    }
+
+    sort(hashes.begin(), hashes.end());
+    assert(adjacent_find(hashes.begin(), hashes.end()) == hashes.end());
+}
+
+void test_bucket_distribution() {
+    // keys that differ in only a few characters spread evenly over the low bits that unordered containers use
+    constexpr size_t key_count    = 100'000;
+    constexpr size_t bucket_count = 1024;
+    for (const string prefix : {"", "key_", "C:\\Program Files\\Common Files\\a rather long directory name\\"}) {
+        vector<size_t> buckets(bucket_count);
+        vector<size_t> hashes;
+        for (size_t i = 0; i < key_count; ++i) {
+            const size_t hash_value = hash<string>{}(prefix + to_string(i));
+            ++buckets[hash_value % bucket_count];
+            hashes.push_back(hash_value);
+        }
+
+        // the mean is about 98 keys per bucket, with a standard deviation of about 10
+        assert(*min_element(buckets.begin(), buckets.end()) > 50);
+        assert(*max_element(buckets.begin(), buckets.end()) < 150);
+
+#ifdef _WIN64
+        sort(hashes.begin(), hashes.end());
+        assert(adjacent_find(hashes.begin(), hashes.end()) == hashes.end());
+#endif // _WIN64
+    }
+}
+
+void test_avalanche() {
+    // flipping any input bit flips each output bit with a probability close to 1/2
+    mt19937 gen{1729};
+    constexpr int trials     = 100;
+    constexpr int hash_bits  = static_cast<int>(sizeof(size_t) * 8);
+    const size_t seeds[]     = {0, 0x1234};
+    const size_t key_sizes[] = {1, 4, 8, 13, 16, 32, 45, 100};
+    for (const size_t seed : seeds) {
+        for (const size_t key_size : key_sizes) {
+            vector<long long> flips(hash_bits);
+            vector<unsigned char> key(key_size);
+            for (int trial = 0; trial < trials; ++trial) {
+                for (auto& byte : key) {
+                    byte = static_cast<unsigned char>(gen());
+                }
+
+                const size_t original = hash_bytes(seed, key);
+                for (size_t bit = 0; bit < key_size * 8; ++bit) {
+                    key[bit / 8] ^= static_cast<unsigned char>(1 << (bit % 8));
+                    const size_t difference = original ^ hash_bytes(seed, key);
+                    key[bit / 8] ^= static_cast<unsigned char>(1 << (bit % 8));
+                    for (int out = 0; out < hash_bits; ++out) {
+                        flips[static_cast<size_t>(out)] += (difference >> out) & 1;
+                    }
+                }
+            }
+
+            const long long samples = static_cast<long long>(trials * key_size * 8);
+            for (const long long count : flips) {
+                assert(count * 10 > samples * 4 && count * 10 < samples * 6);
+            }
+        }
+    }
+}
+
+void test_containers() {
+    unordered_set<string> keys;
+    for (int i = 0; i < 10'000; ++i) {
+        assert(keys.insert("meow" + to_string(i)).second);
+    }
+
+    for (int i = 0; i < 10'000; ++i) {
+        assert(keys.count("meow" + to_string(i)) == 1);
+        assert(keys.count("purr" + to_string(i)) == 0);
+    }
+}
+
+#if _HAS_CXX17
+void test_path() {
+    using filesystem::path;
+    const path equivalents[][3] = {
+        {L"c:\\cat\\dog", L"c:/cat/dog", L"c:\\\\cat//\\dog"},
+        {L"cat\\dog\\", L"cat/dog/", L"cat\\/dog\\\\"},
+        {L"\\\\server\\share\\file", L"\\\\server/share/file", L"\\\\server\\share//file"},
+        {L"c:cat", L"c:cat", L"c:cat"},
+        {L"", L"", L""},
+    };
+
+    for (const auto& group : equivalents) {
+        for (const auto& other : group) {
+            assert(group[0] == other);
+            assert(hash_value(group[0]) == hash_value(other));
+            assert(hash<path>{}(group[0]) == hash_value(other));
+        }
+    }
+
+    unordered_set<path> paths{L"c:\\cat\\dog", L"c:\\cat\\a longer name for a file.txt"};
+    assert(paths.count(L"c:/cat//dog") == 1);
+    assert(paths.count(L"c:/cat/a longer name for a file.txt") == 1);
+    assert(paths.count(L"c:/cat/a longer name for a file.txt/") == 0);
+}
+#endif // _HAS_CXX17
+
+int main() {
+    test_reference_values();
+    test_short_keys();
+    test_bucket_distribution();
+    test_avalanche();
+    test_containers();
+#if _HAS_CXX17
+    test_path();
+#endif // _HAS_CXX17
+}
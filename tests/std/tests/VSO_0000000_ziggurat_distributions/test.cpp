@@ -0,0 +1,175 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <type_traits>
+
+using namespace std;
+
+template <class Engine>
+class counting_engine {
+public:
+    using result_type = typename Engine::result_type;
+
+    static constexpr result_type min() {
+        return Engine::min();
+    }
+    static constexpr result_type max() {
+        return Engine::max();
+    }
+
+    result_type operator()() {
+        ++calls;
+        return eng();
+    }
+
+    Engine eng;
+    size_t calls = 0;
+};
+
+constexpr int samples = 200'000;
+
+// Chi-squared goodness of fit over the bins delimited by bounds, which should include the start of the tail.
+template <size_t N, class Dist, class Engine, class Cdf>
+bool fits(Dist& dist, Engine& eng, const double (&bounds)[N], Cdf cdf, const double threshold) {
+    int frequency[N + 1] = {};
+    for (int i = 0; i < samples; ++i) {
+        const double x = static_cast<double>(dist(eng));
+        size_t bin     = 0;
+        while (bin < N && bounds[bin] <= x) {
+            ++bin;
+        }
+        ++frequency[bin];
+    }
+
+    double chi_squared = 0.0;
+    for (size_t bin = 0; bin <= N; ++bin) {
+        const double lo       = bin == 0 ? 0.0 : cdf(bounds[bin - 1]);
+        const double hi       = bin == N ? 1.0 : cdf(bounds[bin]);
+        const double expected = (hi - lo) * samples;
+        const double delta    = frequency[bin] - expected;
+        chi_squared += delta * delta / expected;
+    }
+
+    return frequency[0] > 0 && frequency[N] > 0 && chi_squared <= threshold;
+}
+
+template <class T, class Engine>
+void test_normal() {
+    using dist_type = stdext::ziggurat_normal_distribution<T>;
+    static_assert(is_same<typename dist_type::result_type, T>::value, "");
+
+    constexpr double tail   = 3.6541528853610088;
+    const double bounds[15] = {-tail, -3.0, -2.5, -2.0, -1.5, -1.0, -0.5, 0.0, 0.5, 1.0, 1.5, 2.0, 2.5, 3.0, tail};
+    const auto cdf          = [](const double x) { return 0.5 * erfc(-x / sqrt(2.0)); };
+
+    Engine eng;
+    dist_type dist;
+    assert(dist.mean() == 0 && dist.stddev() == 1);
+    assert(fits(dist, eng, bounds, cdf, 37.697)); // chi-squared critical value for d.f. = 15 and p = 0.001
+
+    // parameters only scale and shift the standard normal
+    Engine eng1;
+    Engine eng2;
+    dist_type scaled(T{10}, T{2});
+    for (int i = 0; i < 1000; ++i) {
+        const T expected = static_cast<T>(static_cast<T>(dist(eng1)) * T{2} + T{10});
+        assert(abs(scaled(eng2) - expected) <= abs(expected) * T{1e-5} + T{1e-5});
+    }
+
+    const typename dist_type::param_type par(T{-1}, T{0.5});
+    assert(par.mean() == T{-1} && par.stddev() == T{0.5});
+    scaled.param(par);
+    assert(scaled.param() == par);
+    assert(scaled.mean() == T{-1} && scaled.stddev() == T{0.5});
+    assert(scaled != dist);
+    assert(dist == dist_type{});
+    assert((dist.min)() == -numeric_limits<T>::infinity());
+    assert((dist.max)() == numeric_limits<T>::infinity());
+
+    stringstream ss;
+    ss << scaled;
+    dist_type read_back;
+    ss >> read_back;
+    assert(read_back == scaled);
+}
+
+template <class T, class Engine>
+void test_exponential() {
+    using dist_type = stdext::ziggurat_exponential_distribution<T>;
+    static_assert(is_same<typename dist_type::result_type, T>::value, "");
+
+    constexpr double tail   = 7.6971174701310497;
+    const double bounds[17] = {
+        0.125, 0.25, 0.375, 0.5, 0.75, 1.0, 1.25, 1.5, 2.0, 2.5, 3.0, 3.5, 4.0, 5.0, 6.0, 7.0, tail};
+    const auto cdf          = [](const double x) { return 1.0 - exp(-x); };
+
+    Engine eng;
+    dist_type dist;
+    assert(dist.lambda() == 1);
+    for (int i = 0; i < 1000; ++i) {
+        assert(dist(eng) >= 0);
+    }
+
+    // with 200'000 samples, the tail bin gets about 90 values
+    dist_type fast(T{0.125});
+    const auto cdf_fast = [&](const double x) { return cdf(x * 0.125); };
+    double scaled_bounds[17];
+    for (size_t i = 0; i < 17; ++i) {
+        scaled_bounds[i] = bounds[i] * 8.0;
+    }
+    assert(fits(fast, eng, scaled_bounds, cdf_fast, 40.790)); // chi-squared critical value for d.f. = 17 and p = 0.001
+
+    const typename dist_type::param_type par(T{4});
+    assert(par.lambda() == T{4});
+    dist.param(par);
+    assert(dist.param() == par);
+    assert(dist.lambda() == T{4});
+    assert(dist != fast);
+    assert((dist.min)() == 0);
+    assert((dist.max)() == numeric_limits<T>::infinity());
+
+    stringstream ss;
+    ss << fast;
+    dist_type read_back;
+    ss >> read_back;
+    assert(read_back == fast);
+}
+
+template <class T, class Engine>
+void test_engine_calls() {
+    // Most samples take a single engine value when the engine produces as many bits as the ziggurat needs.
+    counting_engine<Engine> eng;
+    stdext::ziggurat_normal_distribution<T> normal;
+    stdext::ziggurat_exponential_distribution<T> exponential;
+    for (int i = 0; i < 10'000; ++i) {
+        (void) normal(eng);
+        (void) exponential(eng);
+    }
+    assert(eng.calls < 20'000 * 105 / 100);
+}
+
+template <class T>
+void test_all() {
+    test_normal<T, mt19937>();
+    test_normal<T, mt19937_64>();
+    test_normal<T, minstd_rand>(); // needs several engine values per sample
+    test_exponential<T, mt19937>();
+    test_exponential<T, mt19937_64>();
+    test_exponential<T, minstd_rand>();
+}
+
+int main() {
+    test_all<float>();
+    test_all<double>();
+    test_all<long double>();
+
+    test_engine_calls<float, mt19937>();
+    test_engine_calls<double, mt19937_64>();
+}
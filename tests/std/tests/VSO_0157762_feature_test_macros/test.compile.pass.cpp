@@ -85,6 +85,12 @@ STATIC_ASSERT(__cpp_lib_atomic_lock_free_type_aliases == 201907L);
 #error __cpp_lib_atomic_lock_free_type_aliases is defined
 #endif
 
+#if _HAS_CXX23
+STATIC_ASSERT(__cpp_lib_atomic_min_max == 202403L);
+#elif defined(__cpp_lib_atomic_min_max)
+#error __cpp_lib_atomic_min_max is defined
+#endif
+
 #if _HAS_CXX20
 STATIC_ASSERT(__cpp_lib_atomic_ref == 201806L);
 #elif defined(__cpp_lib_atomic_ref)
@@ -487,6 +493,12 @@ STATIC_ASSERT(__cpp_lib_has_unique_object_representations == 201606L);
 #error __cpp_lib_has_unique_object_representations is defined
 #endif
 
+#if _HAS_CXX23
+STATIC_ASSERT(__cpp_lib_hazard_pointer == 202306L);
+#elif defined(__cpp_lib_hazard_pointer)
+#error __cpp_lib_hazard_pointer is defined
+#endif
+
 #if _HAS_CXX17
 STATIC_ASSERT(__cpp_lib_hypot == 201603L);
 #elif defined(__cpp_lib_hypot)
@@ -777,6 +789,12 @@ STATIC_ASSERT(__cpp_lib_ranges_fold == 202207L);
 #error __cpp_lib_ranges_fold is defined
 #endif
 
+#if _HAS_CXX23
+STATIC_ASSERT(__cpp_lib_ranges_generate_random == 202403L);
+#elif defined(__cpp_lib_ranges_generate_random)
+#error __cpp_lib_ranges_generate_random is defined
+#endif
+
 #if _HAS_CXX23
 STATIC_ASSERT(__cpp_lib_ranges_iota == 202202L);
 #elif defined(__cpp_lib_ranges_iota)
@@ -831,6 +849,12 @@ STATIC_ASSERT(__cpp_lib_raw_memory_algorithms == 201606L);
 #error __cpp_lib_raw_memory_algorithms is defined
 #endif
 
+#if _HAS_CXX23
+STATIC_ASSERT(__cpp_lib_rcu == 202306L);
+#elif defined(__cpp_lib_rcu)
+#error __cpp_lib_rcu is defined
+#endif
+
 #if _HAS_CXX20
 STATIC_ASSERT(__cpp_lib_remove_cvref == 201711L);
 #elif defined(__cpp_lib_remove_cvref)